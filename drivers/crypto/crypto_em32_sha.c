@@ -16,6 +16,8 @@
 #include <string.h>
 #include <soc.h>
 #include "../../include/zephyr/drivers/clock_control/clock_control_em32_apb.h"
+#include "../../include/zephyr/drivers/dma/dma_em32.h"
+#include "../../include/zephyr/drivers/crypto/crypto_em32.h"
 
 LOG_MODULE_REGISTER(crypto_em32_sha, CONFIG_CRYPTO_LOG_LEVEL);
 
@@ -121,6 +123,8 @@ struct crypto_em32_data {
     uint8_t final_rem_len;
 
     bool session_active;
+    /* Exclusive use of the ENCRYPT block, shared with AES users */
+    struct k_sem hw_lock;
 #ifdef CONFIG_CRYPTO_EM32_SHA_INTERRUPT
     struct k_sem op_complete;
 #endif
@@ -176,7 +180,7 @@ static int ensure_accum_capacity(struct crypto_em32_data *data, size_t need)
         return -ENOMEM;
     }
     if (data->accum_len && data->accum_buf) {
-        memcpy(new_buf, data->accum_buf, data->accum_len);
+        (void)dma_em32_memcpy(new_buf, data->accum_buf, data->accum_len);
         k_free(data->accum_buf);
     }
     data->accum_buf = new_buf;
@@ -189,7 +193,7 @@ static int accum_append(struct crypto_em32_data *data, const uint8_t *src, size_
     if (len == 0) return 0;
     int ret = ensure_accum_capacity(data, data->accum_len + len);
     if (ret) return ret;
-    memcpy(data->accum_buf + data->accum_len, src, len);
+    (void)dma_em32_memcpy(data->accum_buf + data->accum_len, src, len);
     data->accum_len += len;
     return 0;
 }
@@ -215,7 +219,7 @@ static int ensure_chunk_capacity(struct crypto_em32_data *data, size_t need)
 
     if (data->chunk_buf) {
         if (data->chunk_buf_len) {
-            memcpy(new_buf, data->chunk_buf, data->chunk_buf_len);
+            (void)dma_em32_memcpy(new_buf, data->chunk_buf, data->chunk_buf_len);
         }
         k_free(data->chunk_buf);
     }
@@ -233,7 +237,7 @@ static int chunk_append(struct crypto_em32_data *data, const uint8_t *src, size_
     int ret = ensure_chunk_capacity(data, data->chunk_buf_len + len);
     if (ret) return ret;
 
-    memcpy(data->chunk_buf + data->chunk_buf_len, src, len);
+    (void)dma_em32_memcpy(data->chunk_buf + data->chunk_buf_len, src, len);
     data->chunk_buf_len += len;
     return 0;
 }
@@ -429,7 +433,7 @@ static int crypto_em32_query_hw_caps(const struct device *dev)
     return CAP_SEPARATE_IO_BUFS | CAP_SYNC_OPS;
 }
 
-static int em32_sha256_handler(struct hash_ctx *ctx, struct hash_pkt *pkt, bool finish)
+static int em32_sha256_process(struct hash_ctx *ctx, struct hash_pkt *pkt, bool finish)
 {
     const struct device *dev = ctx->device;
     struct crypto_em32_data *data = dev->data;
@@ -452,8 +456,18 @@ static int em32_sha256_handler(struct hash_ctx *ctx, struct hash_pkt *pkt, bool
         /* Check if we need to switch to chunked processing FIRST */
         /* Switch to chunked if:
          * 1. Single input chunk is 64KB or larger (chunk-sized input), OR
-         * 2. Total data exceeds max accumulation size
+         * 2. Total data exceeds max accumulation size, OR
+         * 3. The total length was set up front: DATALEN and PAD_CTR can be
+         *    programmed on the first update, so every update is streamed to
+         *    the engine as it arrives. All updates but the last must then be
+         *    a multiple of 4 bytes.
          */
+        if (!data->use_chunked && data->have_expected_total) {
+            data->use_chunked = true;
+            data->total_bytes_processed = 0;
+            data->chunk_state_valid = false;
+        }
+
         if (!data->use_chunked && pkt->in_len >= SHA256_CHUNK_SIZE) {
             LOG_INF("Switching to chunked processing for large input (input=%zu bytes >= %u bytes)",
                     pkt->in_len, SHA256_CHUNK_SIZE);
@@ -677,6 +691,32 @@ static int em32_sha256_handler(struct hash_ctx *ctx, struct hash_pkt *pkt, bool
     return 0;
 }
 
+static int em32_sha256_handler(struct hash_ctx *ctx, struct hash_pkt *pkt, bool finish)
+{
+    const struct device *dev = ctx->device;
+    int ret;
+
+    crypto_em32_lock(dev, K_FOREVER);
+    ret = em32_sha256_process(ctx, pkt, finish);
+    crypto_em32_unlock(dev);
+
+    return ret;
+}
+
+int crypto_em32_lock(const struct device *dev, k_timeout_t timeout)
+{
+    struct crypto_em32_data *data = dev->data;
+
+    return k_sem_take(&data->hw_lock, timeout);
+}
+
+void crypto_em32_unlock(const struct device *dev)
+{
+    struct crypto_em32_data *data = dev->data;
+
+    k_sem_give(&data->hw_lock);
+}
+
 static int crypto_em32_hash_begin_session(const struct device *dev,
                                          struct hash_ctx *ctx,
                                          enum hash_algo algo)
@@ -728,8 +768,10 @@ static int crypto_em32_hash_begin_session(const struct device *dev,
     ctx->hash_hndlr = em32_sha256_handler;
 
     /* Reset and configure hardware */
+    crypto_em32_lock(dev, K_FOREVER);
     sha_reset(dev);
     sha_configure(dev);
+    crypto_em32_unlock(dev);
 
 
 
@@ -738,7 +780,9 @@ static int crypto_em32_hash_begin_session(const struct device *dev,
 
 
 /* Application helper: set total message length for chunked processing.
- * This ensures the first chunk programs DATALEN to the TOTAL byte count.
+ * This ensures the first chunk programs DATALEN to the TOTAL byte count,
+ * and every following update is streamed to the engine without buffering.
+ * Call it after hash_begin_session() and before the first update.
  */
 int crypto_em32_sha_set_total_length(const struct device *dev, size_t total_bytes)
 {
@@ -881,6 +925,7 @@ static int crypto_em32_init(const struct device *dev)
     data->state = SHA_STATE_IDLE;
     data->ctx = NULL;
     data->callback = NULL;
+    k_sem_init(&data->hw_lock, 1, 1);
 
 #ifdef CONFIG_CRYPTO_EM32_SHA_INTERRUPT
     k_sem_init(&data->op_complete, 0, 1);
@@ -0,0 +1,314 @@
+/*
+ * EM32F967 DMA memory copy/fill offload service
+ *
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+#include "../../include/zephyr/drivers/dma/dma_em32.h"
+
+LOG_MODULE_REGISTER(dma_em32_memcpy, CONFIG_DMA_LOG_LEVEL);
+
+#define MEMCPY_CHANNEL    CONFIG_DMA_EM32_MEMCPY_CHANNEL
+#define MEMCPY_THRESHOLD  CONFIG_DMA_EM32_MEMCPY_THRESHOLD
+#define MEMCPY_MAX_BLOCKS CONFIG_DMA_EM32F967_MAX_BLOCKS
+
+/* BLOCK_TS is 12 bits wide: at most 4095 items per block */
+#define MEMCPY_MAX_ITEMS  4095U
+/* Burst of four items keeps the channel FIFO busy without hogging the bus */
+#define MEMCPY_BURST_ITEMS 4U
+
+struct dma_em32_copy {
+	const struct device *dma_dev;
+	struct k_sem lock;
+	struct k_sem done;
+	struct dma_config cfg;
+	struct dma_block_config blocks[MEMCPY_MAX_BLOCKS];
+	uint32_t fill_word;
+	uintptr_t src;
+	uintptr_t dst;
+	size_t remaining;
+	uint8_t width;
+	bool fill;
+	int status;
+	dma_em32_copy_cb_t cb;
+	void *user_data;
+	bool ready;
+};
+
+static struct dma_em32_copy copy;
+
+static int copy_program_next(void);
+
+static void copy_finish(int status)
+{
+	dma_em32_copy_cb_t cb = copy.cb;
+	void *user_data = copy.user_data;
+
+	copy.status = status;
+
+	if (cb != NULL) {
+		/*
+		 * This runs in the DMA ISR, so a failed range is not redone here:
+		 * the error goes to the caller, which may retry it.
+		 */
+		k_sem_give(&copy.lock);
+		cb(status, user_data);
+	} else {
+		k_sem_give(&copy.done);
+	}
+}
+
+static void copy_dma_callback(const struct device *dma_dev, void *arg, uint32_t channel,
+			      int status)
+{
+	ARG_UNUSED(dma_dev);
+	ARG_UNUSED(arg);
+	ARG_UNUSED(channel);
+
+	if (status < 0) {
+		LOG_ERR("DMA copy error %d", status);
+		copy_finish(status);
+		return;
+	}
+
+	if (status != DMA_STATUS_COMPLETE) {
+		return;
+	}
+
+	if (copy.remaining > 0U) {
+		int ret = copy_program_next();
+
+		if (ret < 0) {
+			copy_finish(ret);
+		}
+		return;
+	}
+
+	copy_finish(0);
+}
+
+/* Queue up to MEMCPY_MAX_BLOCKS linked blocks of the outstanding range */
+static int copy_program_next(void)
+{
+	struct dma_config *cfg = &copy.cfg;
+	size_t max_block = MEMCPY_MAX_ITEMS * copy.width;
+	uint32_t count = 0;
+	int ret;
+
+	memset(cfg, 0, sizeof(*cfg));
+	cfg->channel_direction = MEMORY_TO_MEMORY;
+	cfg->source_data_size = copy.width;
+	cfg->dest_data_size = copy.width;
+	cfg->source_burst_length = MEMCPY_BURST_ITEMS * copy.width;
+	cfg->dest_burst_length = MEMCPY_BURST_ITEMS * copy.width;
+	cfg->dma_callback = copy_dma_callback;
+	cfg->head_block = &copy.blocks[0];
+
+	while (copy.remaining > 0U && count < MEMCPY_MAX_BLOCKS) {
+		struct dma_block_config *blk = &copy.blocks[count];
+		size_t len = MIN(copy.remaining, max_block);
+
+		memset(blk, 0, sizeof(*blk));
+		blk->source_address = copy.fill ? (uint32_t)(uintptr_t)&copy.fill_word :
+						  (uint32_t)copy.src;
+		blk->dest_address = (uint32_t)copy.dst;
+		blk->block_size = len;
+		blk->source_addr_adj = copy.fill ? DMA_ADDR_ADJ_NO_CHANGE : DMA_ADDR_ADJ_INCREMENT;
+		blk->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		if (count > 0U) {
+			copy.blocks[count - 1U].next_block = blk;
+		}
+
+		copy.src += copy.fill ? 0U : len;
+		copy.dst += len;
+		copy.remaining -= len;
+		count++;
+	}
+
+	cfg->block_count = count;
+
+	ret = dma_config(copy.dma_dev, MEMCPY_CHANNEL, cfg);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return dma_start(copy.dma_dev, MEMCPY_CHANNEL);
+}
+
+static void copy_cpu(void *dst, const void *src, uint8_t val, size_t len, bool fill)
+{
+	if (fill) {
+		memset(dst, val, len);
+	} else {
+		memcpy(dst, src, len);
+	}
+}
+
+/*
+ * Copy the unaligned head and tail on the CPU and leave the aligned middle
+ * to the engine. A source and destination with different word offsets fall
+ * back to byte-wide transfers so the whole range still goes through DMA.
+ */
+static void copy_prepare(uint8_t *dst, const uint8_t *src, uint8_t val, size_t len, bool fill)
+{
+	size_t head;
+	size_t tail;
+
+	if (!fill && (((uintptr_t)dst ^ (uintptr_t)src) & 0x3U) != 0U) {
+		copy.width = 1;
+		copy.src = (uintptr_t)src;
+		copy.dst = (uintptr_t)dst;
+		copy.remaining = len;
+		return;
+	}
+
+	head = (4U - ((uintptr_t)dst & 0x3U)) & 0x3U;
+	tail = (len - head) & 0x3U;
+
+	copy_cpu(dst, src, val, head, fill);
+	copy_cpu(dst + len - tail, fill ? NULL : src + len - tail, val, tail, fill);
+
+	copy.width = 4;
+	copy.src = fill ? 0U : (uintptr_t)(src + head);
+	copy.dst = (uintptr_t)(dst + head);
+	copy.remaining = len - head - tail;
+}
+
+static int copy_submit(void *dst, const void *src, uint8_t val, size_t len, bool fill,
+		       dma_em32_copy_cb_t cb, void *user_data)
+{
+	bool async = cb != NULL;
+	int ret;
+
+	if (len == 0U) {
+		goto cpu_done;
+	}
+
+	if (len < MEMCPY_THRESHOLD || !copy.ready || k_is_pre_kernel() ||
+	    (!async && k_is_in_isr())) {
+		goto cpu;
+	}
+
+	if (k_sem_take(&copy.lock, async ? K_NO_WAIT : K_FOREVER) != 0) {
+		/* Channel busy with another async request: don't wait */
+		goto cpu;
+	}
+
+	copy.fill = fill;
+	copy.fill_word = val * 0x01010101U;
+	copy.cb = cb;
+	copy.user_data = user_data;
+	copy_prepare(dst, src, val, len, fill);
+
+	if (copy.remaining == 0U) {
+		k_sem_give(&copy.lock);
+		goto cpu_done;
+	}
+
+	k_sem_reset(&copy.done);
+
+	ret = copy_program_next();
+	if (ret < 0) {
+		LOG_ERR("DMA copy start failed %d", ret);
+		k_sem_give(&copy.lock);
+		goto cpu;
+	}
+
+	if (async) {
+		return 0;
+	}
+
+	if (k_sem_take(&copy.done, K_MSEC(CONFIG_DMA_EM32_MEMCPY_TIMEOUT_MS)) != 0) {
+		LOG_WRN("DMA copy timed out, finishing on CPU");
+		(void)dma_stop(copy.dma_dev, MEMCPY_CHANNEL);
+		copy.status = 0;
+		k_sem_give(&copy.lock);
+		goto cpu;
+	}
+
+	ret = copy.status;
+	k_sem_give(&copy.lock);
+
+	if (ret < 0) {
+		/* Copying and filling are idempotent, so redo the range on the CPU */
+		goto cpu;
+	}
+
+	return 0;
+
+cpu:
+	copy_cpu(dst, src, val, len, fill);
+cpu_done:
+	if (cb != NULL) {
+		cb(0, user_data);
+	}
+	return 0;
+}
+
+int dma_em32_memcpy(void *dst, const void *src, size_t len)
+{
+	return copy_submit(dst, src, 0, len, false, NULL, NULL);
+}
+
+int dma_em32_memset(void *dst, uint8_t val, size_t len)
+{
+	return copy_submit(dst, NULL, val, len, true, NULL, NULL);
+}
+
+int dma_em32_memcpy_async(void *dst, const void *src, size_t len, dma_em32_copy_cb_t cb,
+			  void *user_data)
+{
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	return copy_submit(dst, src, 0, len, false, cb, user_data);
+}
+
+int dma_em32_memset_async(void *dst, uint8_t val, size_t len, dma_em32_copy_cb_t cb,
+			  void *user_data)
+{
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	return copy_submit(dst, NULL, val, len, true, cb, user_data);
+}
+
+static int dma_em32_memcpy_init(void)
+{
+	uint32_t filter = BIT(MEMCPY_CHANNEL);
+	int ret;
+
+	copy.dma_dev = DEVICE_DT_GET_ONE(elan_em32f967_dma);
+
+	k_sem_init(&copy.lock, 1, 1);
+	k_sem_init(&copy.done, 0, 1);
+
+	if (!device_is_ready(copy.dma_dev)) {
+		LOG_WRN("DMA not ready, memcpy offload disabled");
+		return 0;
+	}
+
+	/* Reserve the channel so DMA clients cannot be handed it */
+	ret = dma_request_channel(copy.dma_dev, &filter);
+	if (ret != MEMCPY_CHANNEL) {
+		LOG_WRN("DMA channel %d unavailable, memcpy offload disabled", MEMCPY_CHANNEL);
+		return 0;
+	}
+
+	copy.ready = true;
+
+	return 0;
+}
+
+SYS_INIT(dma_em32_memcpy_init, POST_KERNEL, CONFIG_DMA_EM32_MEMCPY_INIT_PRIORITY);
@@ -0,0 +1,760 @@
+/*
+ * EM32F967 DMA controller driver
+ *
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT elan_em32f967_dma
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/irq.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/atomic.h>
+#include <soc.h>
+#include "../../include/zephyr/drivers/clock_control/clock_control_em32_apb.h"
+
+LOG_MODULE_REGISTER(dma_em32f967, CONFIG_DMA_LOG_LEVEL);
+
+#define DMA_EM32_MAX_CHANNELS 8
+#define DMA_EM32_MAX_BLOCKS   CONFIG_DMA_EM32F967_MAX_BLOCKS
+
+/* Per-channel register offsets (channel stride 0x58) */
+#define DMA_CH_STRIDE 0x58
+#define DMA_CH_SAR    0x00
+#define DMA_CH_DAR    0x08
+#define DMA_CH_LLP    0x10
+#define DMA_CH_CTL_LO 0x18
+#define DMA_CH_CTL_HI 0x1C
+#define DMA_CH_CFG_LO 0x40
+#define DMA_CH_CFG_HI 0x44
+
+/* Interrupt and common register offsets */
+#define DMA_RAW_TFR      0x2C0
+#define DMA_STATUS_TFR   0x2E8
+#define DMA_STATUS_BLOCK 0x2F0
+#define DMA_STATUS_ERR   0x308
+#define DMA_MASK_TFR     0x310
+#define DMA_MASK_BLOCK   0x318
+#define DMA_MASK_SRCTRAN 0x320
+#define DMA_MASK_DSTTRAN 0x328
+#define DMA_MASK_ERR     0x330
+#define DMA_CLEAR_TFR    0x338
+#define DMA_CLEAR_BLOCK  0x340
+#define DMA_CLEAR_SRCTRAN 0x348
+#define DMA_CLEAR_DSTTRAN 0x350
+#define DMA_CLEAR_ERR    0x358
+#define DMA_CFG_REG      0x398
+#define DMA_CH_EN_REG    0x3A0
+
+/* CTL_LO fields */
+#define CTL_LO_INT_EN          BIT(0)
+#define CTL_LO_DST_WIDTH(x)    (((x) & 0x7) << 1)
+#define CTL_LO_SRC_WIDTH(x)    (((x) & 0x7) << 4)
+#define CTL_LO_DINC(x)         (((x) & 0x3) << 7)
+#define CTL_LO_SINC(x)         (((x) & 0x3) << 9)
+#define CTL_LO_DST_MSIZE(x)    (((x) & 0x7) << 11)
+#define CTL_LO_SRC_MSIZE(x)    (((x) & 0x7) << 14)
+#define CTL_LO_TT_FC(x)        (((x) & 0x7) << 20)
+#define CTL_LO_LLP_DST_EN      BIT(27)
+#define CTL_LO_LLP_SRC_EN      BIT(28)
+
+#define CTL_LO_INC_INCREMENT   0
+#define CTL_LO_INC_DECREMENT   1
+#define CTL_LO_INC_NO_CHANGE   2
+
+#define CTL_LO_TT_FC_M2M       0
+#define CTL_LO_TT_FC_M2P       1
+#define CTL_LO_TT_FC_P2M       2
+
+/* CTL_HI fields */
+#define CTL_HI_BLOCK_TS_MASK   0xFFF
+#define CTL_HI_DONE            BIT(12)
+#define DMA_EM32_MAX_BLOCK_TS  CTL_HI_BLOCK_TS_MASK
+
+/* CFG_LO fields */
+#define CFG_LO_CH_PRIOR(x)     (((x) & 0x7) << 5)
+#define CFG_LO_CH_SUSP         BIT(8)
+#define CFG_LO_FIFO_EMPTY      BIT(9)
+#define CFG_LO_HS_SEL_DST      BIT(10)
+#define CFG_LO_HS_SEL_SRC      BIT(11)
+
+/* CFG_HI fields */
+#define CFG_HI_FIFO_MODE       BIT(1)
+#define CFG_HI_SRC_PER(x)      (((x) & 0xF) << 7)
+#define CFG_HI_DEST_PER(x)     (((x) & 0xF) << 11)
+
+/* Channel enable / mask registers carry write-enable bits in [15:8] */
+#define DMA_CH_WE(ch)          BIT((ch) + 8)
+#define DMA_CH_SET(ch)         (BIT(ch) | DMA_CH_WE(ch))
+#define DMA_CH_CLR(ch)         DMA_CH_WE(ch)
+
+#define DMA_SUSPEND_TIMEOUT_US 1000
+#define DMA_DISABLE_TIMEOUT_US 1000
+
+/* SYSCFG DMA_HS_SELECT: TFR_INT_SEL picks the one channel whose TFR drives IRQ 54 */
+#define DMA_HS_SELECT_REG       0x4003000CUL
+#define DMA_HS_TFR_INT_SEL_MASK GENMASK(18, 16)
+#define DMA_HS_TFR_INT_SEL(ch)  (((ch) & 0x7) << 16)
+
+#define DMA_REG(base, off) (*((volatile uint32_t *)((base) + (off))))
+#define DMA_READ(base, off) (DMA_REG(base, off))
+#define DMA_WRITE(base, off, val) (DMA_REG(base, off) = (uint32_t)(val))
+#define DMA_CH_OFF(ch, off) ((ch) * DMA_CH_STRIDE + (off))
+
+/* Hardware linked-list item, consumed directly by the controller */
+struct dma_em32_lli {
+	uint32_t sar;
+	uint32_t dar;
+	uint32_t llp;
+	uint32_t ctl_lo;
+	uint32_t ctl_hi;
+	uint32_t sstat;
+	uint32_t dstat;
+} __aligned(4);
+
+struct dma_em32_channel {
+	dma_callback_t callback;
+	void *user_data;
+	enum dma_channel_direction direction;
+	uint32_t ctl_lo;
+	uint32_t cfg_lo;
+	uint32_t cfg_hi;
+	uint32_t src_width;
+	uint32_t total_bytes;
+	uint8_t block_count;
+	bool cyclic;
+	bool block_cb;
+	bool error_cb;
+	bool configured;
+	bool busy;
+	struct dma_em32_lli lli[DMA_EM32_MAX_BLOCKS];
+};
+
+struct dma_em32_config {
+	uintptr_t base;
+	const struct device *clock_dev;
+	uint32_t clock_group;
+	uint8_t channels;
+	uint8_t tfr_int_channel;
+	void (*irq_config)(const struct device *dev);
+};
+
+struct dma_em32_data {
+	/* dma_context must be first, the generic channel helpers rely on it */
+	struct dma_context ctx;
+	ATOMIC_DEFINE(channels_atomic, DMA_EM32_MAX_CHANNELS);
+	struct dma_em32_channel chan[DMA_EM32_MAX_CHANNELS];
+};
+
+static int dma_em32_width(uint32_t size)
+{
+	switch (size) {
+	case 1:
+		return 0;
+	case 2:
+		return 1;
+	case 4:
+		return 2;
+	default:
+		return -EINVAL;
+	}
+}
+
+/* Convert a burst length in bytes to the MSIZE encoding (1, 4, 8, 16, ... items) */
+static int dma_em32_msize(uint32_t burst_bytes, uint32_t data_size)
+{
+	uint32_t items = burst_bytes / data_size;
+
+	if (items <= 1U) {
+		return 0;
+	}
+
+	switch (items) {
+	case 4:
+		return 1;
+	case 8:
+		return 2;
+	case 16:
+		return 3;
+	case 32:
+		return 4;
+	default:
+		return -EINVAL;
+	}
+}
+
+static int dma_em32_addr_inc(uint16_t adj)
+{
+	switch (adj) {
+	case DMA_ADDR_ADJ_INCREMENT:
+		return CTL_LO_INC_INCREMENT;
+	case DMA_ADDR_ADJ_DECREMENT:
+		return CTL_LO_INC_DECREMENT;
+	case DMA_ADDR_ADJ_NO_CHANGE:
+		return CTL_LO_INC_NO_CHANGE;
+	default:
+		return -EINVAL;
+	}
+}
+
+static inline bool dma_em32_channel_enabled(uintptr_t base, uint32_t channel)
+{
+	return (DMA_READ(base, DMA_CH_EN_REG) & BIT(channel)) != 0U;
+}
+
+/*
+ * BLOCK is unmasked even without block callbacks: the TFR line only serves
+ * the channel selected by TFR_INT_SEL, so the other channels see the end of
+ * their last block on the BLOCK line and the ISR picks up TFR status there.
+ */
+static void dma_em32_irq_mask(uintptr_t base, uint32_t channel)
+{
+	DMA_WRITE(base, DMA_MASK_TFR, DMA_CH_SET(channel));
+	DMA_WRITE(base, DMA_MASK_ERR, DMA_CH_SET(channel));
+	DMA_WRITE(base, DMA_MASK_BLOCK, DMA_CH_SET(channel));
+}
+
+static void dma_em32_irq_clear(uintptr_t base, uint32_t channel)
+{
+	DMA_WRITE(base, DMA_CLEAR_TFR, BIT(channel));
+	DMA_WRITE(base, DMA_CLEAR_BLOCK, BIT(channel));
+	DMA_WRITE(base, DMA_CLEAR_SRCTRAN, BIT(channel));
+	DMA_WRITE(base, DMA_CLEAR_DSTTRAN, BIT(channel));
+	DMA_WRITE(base, DMA_CLEAR_ERR, BIT(channel));
+}
+
+static int dma_em32_configure(const struct device *dev, uint32_t channel,
+			      struct dma_config *config)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	struct dma_em32_data *data = dev->data;
+	struct dma_em32_channel *ch;
+	struct dma_block_config *block;
+	uint32_t ctl_lo;
+	uint32_t cfg_lo;
+	uint32_t cfg_hi = CFG_HI_FIFO_MODE;
+	uint32_t total = 0;
+	int src_w, dst_w, src_msize, dst_msize;
+
+	if (channel >= cfg->channels || config == NULL || config->head_block == NULL) {
+		return -EINVAL;
+	}
+
+	if (config->block_count == 0U || config->block_count > DMA_EM32_MAX_BLOCKS) {
+		LOG_ERR("Unsupported block count %u (max %u)", config->block_count,
+			DMA_EM32_MAX_BLOCKS);
+		return -EINVAL;
+	}
+
+	src_w = dma_em32_width(config->source_data_size);
+	dst_w = dma_em32_width(config->dest_data_size);
+	if (src_w < 0 || dst_w < 0) {
+		LOG_ERR("Unsupported data size %u/%u", config->source_data_size,
+			config->dest_data_size);
+		return -EINVAL;
+	}
+
+	src_msize = dma_em32_msize(config->source_burst_length, config->source_data_size);
+	dst_msize = dma_em32_msize(config->dest_burst_length, config->dest_data_size);
+	if (src_msize < 0 || dst_msize < 0) {
+		LOG_ERR("Unsupported burst length %u/%u", config->source_burst_length,
+			config->dest_burst_length);
+		return -EINVAL;
+	}
+
+	ch = &data->chan[channel];
+	if (ch->busy && dma_em32_channel_enabled(cfg->base, channel)) {
+		return -EBUSY;
+	}
+
+	ctl_lo = CTL_LO_INT_EN | CTL_LO_DST_WIDTH(dst_w) | CTL_LO_SRC_WIDTH(src_w) |
+		 CTL_LO_DST_MSIZE(dst_msize) | CTL_LO_SRC_MSIZE(src_msize);
+	cfg_lo = CFG_LO_CH_PRIOR(MIN(config->channel_priority, 7U));
+
+	switch (config->channel_direction) {
+	case MEMORY_TO_MEMORY:
+		ctl_lo |= CTL_LO_TT_FC(CTL_LO_TT_FC_M2M);
+		cfg_lo |= CFG_LO_HS_SEL_DST | CFG_LO_HS_SEL_SRC;
+		break;
+	case MEMORY_TO_PERIPHERAL:
+		ctl_lo |= CTL_LO_TT_FC(CTL_LO_TT_FC_M2P);
+		cfg_lo |= CFG_LO_HS_SEL_SRC;
+		cfg_hi |= CFG_HI_DEST_PER(config->dma_slot);
+		break;
+	case PERIPHERAL_TO_MEMORY:
+		ctl_lo |= CTL_LO_TT_FC(CTL_LO_TT_FC_P2M);
+		cfg_lo |= CFG_LO_HS_SEL_DST;
+		cfg_hi |= CFG_HI_SRC_PER(config->dma_slot);
+		break;
+	default:
+		LOG_ERR("Unsupported direction %u", config->channel_direction);
+		return -ENOTSUP;
+	}
+
+	block = config->head_block;
+	for (uint32_t i = 0; i < config->block_count; i++) {
+		struct dma_em32_lli *lli = &ch->lli[i];
+		uint32_t items;
+		int sinc, dinc;
+
+		if (block == NULL) {
+			return -EINVAL;
+		}
+
+		items = block->block_size / config->source_data_size;
+		if (items == 0U || items > DMA_EM32_MAX_BLOCK_TS ||
+		    (block->block_size % config->source_data_size) != 0U) {
+			LOG_ERR("Block %u size %u not supported", i, block->block_size);
+			return -EINVAL;
+		}
+
+		sinc = dma_em32_addr_inc(block->source_addr_adj);
+		dinc = dma_em32_addr_inc(block->dest_addr_adj);
+		if (sinc < 0 || dinc < 0) {
+			return -EINVAL;
+		}
+
+		lli->sar = block->source_address;
+		lli->dar = block->dest_address;
+		lli->ctl_lo = ctl_lo | CTL_LO_SINC(sinc) | CTL_LO_DINC(dinc);
+		lli->ctl_hi = items;
+		lli->sstat = 0;
+		lli->dstat = 0;
+
+		if (i + 1U < config->block_count) {
+			lli->llp = (uint32_t)(uintptr_t)&ch->lli[i + 1U];
+			lli->ctl_lo |= CTL_LO_LLP_SRC_EN | CTL_LO_LLP_DST_EN;
+		} else if (config->cyclic) {
+			lli->llp = (uint32_t)(uintptr_t)&ch->lli[0];
+			lli->ctl_lo |= CTL_LO_LLP_SRC_EN | CTL_LO_LLP_DST_EN;
+		} else {
+			lli->llp = 0;
+		}
+
+		total += block->block_size;
+		block = block->next_block;
+	}
+
+	ch->callback = config->dma_callback;
+	ch->user_data = config->user_data;
+	ch->direction = config->channel_direction;
+	ch->ctl_lo = ctl_lo;
+	ch->cfg_lo = cfg_lo;
+	ch->cfg_hi = cfg_hi;
+	ch->src_width = config->source_data_size;
+	ch->total_bytes = total;
+	ch->block_count = config->block_count;
+	ch->cyclic = config->cyclic;
+	/* complete_callback_en asks for a callback after every block */
+	ch->block_cb = config->complete_callback_en || config->cyclic;
+	ch->error_cb = !config->error_callback_dis;
+	ch->configured = true;
+
+	return 0;
+}
+
+static void dma_em32_load_channel(const struct dma_em32_config *cfg, uint32_t channel,
+				  const struct dma_em32_channel *ch)
+{
+	const struct dma_em32_lli *head = &ch->lli[0];
+
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO), ch->cfg_lo);
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_HI), ch->cfg_hi);
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_SAR), head->sar);
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_DAR), head->dar);
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_CTL_LO), head->ctl_lo);
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_CTL_HI), head->ctl_hi);
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_LLP),
+		  (head->ctl_lo & CTL_LO_LLP_SRC_EN) ? head->llp : 0U);
+}
+
+static int dma_em32_start(const struct device *dev, uint32_t channel)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	struct dma_em32_data *data = dev->data;
+	struct dma_em32_channel *ch;
+	unsigned int key;
+
+	if (channel >= cfg->channels) {
+		return -EINVAL;
+	}
+
+	ch = &data->chan[channel];
+	if (!ch->configured) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	if (dma_em32_channel_enabled(cfg->base, channel)) {
+		irq_unlock(key);
+		return -EBUSY;
+	}
+
+	dma_em32_irq_clear(cfg->base, channel);
+	dma_em32_load_channel(cfg, channel, ch);
+	dma_em32_irq_mask(cfg->base, channel);
+
+	ch->busy = true;
+	DMA_WRITE(cfg->base, DMA_CH_EN_REG, DMA_CH_SET(channel));
+
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int dma_em32_stop(const struct device *dev, uint32_t channel)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	struct dma_em32_data *data = dev->data;
+	uint32_t cfg_lo;
+	uint32_t timeout = DMA_SUSPEND_TIMEOUT_US;
+	int ret = 0;
+
+	if (channel >= cfg->channels) {
+		return -EINVAL;
+	}
+
+	if (dma_em32_channel_enabled(cfg->base, channel)) {
+		/* Suspend first so the channel FIFO drains before disabling */
+		cfg_lo = DMA_READ(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO));
+		DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO), cfg_lo | CFG_LO_CH_SUSP);
+
+		while (!(DMA_READ(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO)) &
+			 CFG_LO_FIFO_EMPTY) && timeout-- > 0U) {
+			k_busy_wait(1);
+		}
+
+		DMA_WRITE(cfg->base, DMA_CH_EN_REG, DMA_CH_CLR(channel));
+		timeout = DMA_DISABLE_TIMEOUT_US;
+		while (dma_em32_channel_enabled(cfg->base, channel) && timeout-- > 0U) {
+			k_busy_wait(1);
+		}
+
+		if (dma_em32_channel_enabled(cfg->base, channel)) {
+			LOG_ERR("DMA channel %u did not disable", channel);
+			ret = -ETIMEDOUT;
+		}
+
+		DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO), cfg_lo & ~CFG_LO_CH_SUSP);
+	}
+
+	DMA_WRITE(cfg->base, DMA_MASK_TFR, DMA_CH_CLR(channel));
+	DMA_WRITE(cfg->base, DMA_MASK_BLOCK, DMA_CH_CLR(channel));
+	DMA_WRITE(cfg->base, DMA_MASK_ERR, DMA_CH_CLR(channel));
+	dma_em32_irq_clear(cfg->base, channel);
+
+	data->chan[channel].busy = false;
+
+	return ret;
+}
+
+static int dma_em32_reload(const struct device *dev, uint32_t channel, uint32_t src,
+			   uint32_t dst, size_t size)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	struct dma_em32_data *data = dev->data;
+	struct dma_em32_channel *ch;
+	struct dma_em32_lli *lli;
+	uint32_t items;
+
+	if (channel >= cfg->channels) {
+		return -EINVAL;
+	}
+
+	ch = &data->chan[channel];
+	if (!ch->configured) {
+		return -EINVAL;
+	}
+
+	if (dma_em32_channel_enabled(cfg->base, channel)) {
+		return -EBUSY;
+	}
+
+	items = size / ch->src_width;
+	if (items == 0U || items > DMA_EM32_MAX_BLOCK_TS || (size % ch->src_width) != 0U) {
+		return -EINVAL;
+	}
+
+	/* Reload collapses the transfer to a single block at the new addresses */
+	lli = &ch->lli[0];
+	lli->sar = src;
+	lli->dar = dst;
+	lli->ctl_hi = items;
+	if (!ch->cyclic) {
+		lli->llp = 0;
+		lli->ctl_lo &= ~(CTL_LO_LLP_SRC_EN | CTL_LO_LLP_DST_EN);
+	} else {
+		lli->llp = (uint32_t)(uintptr_t)lli;
+	}
+	ch->block_count = 1;
+	ch->total_bytes = size;
+
+	return 0;
+}
+
+static int dma_em32_suspend(const struct device *dev, uint32_t channel)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	uint32_t cfg_lo;
+
+	if (channel >= cfg->channels) {
+		return -EINVAL;
+	}
+
+	if (!dma_em32_channel_enabled(cfg->base, channel)) {
+		return -EINVAL;
+	}
+
+	cfg_lo = DMA_READ(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO));
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO), cfg_lo | CFG_LO_CH_SUSP);
+
+	return 0;
+}
+
+static int dma_em32_resume(const struct device *dev, uint32_t channel)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	uint32_t cfg_lo;
+
+	if (channel >= cfg->channels) {
+		return -EINVAL;
+	}
+
+	if (!dma_em32_channel_enabled(cfg->base, channel)) {
+		return -EINVAL;
+	}
+
+	cfg_lo = DMA_READ(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO));
+	DMA_WRITE(cfg->base, DMA_CH_OFF(channel, DMA_CH_CFG_LO), cfg_lo & ~CFG_LO_CH_SUSP);
+
+	return 0;
+}
+
+/*
+ * Bytes moved in the current pass over the block list. LLP holds the item
+ * after the active one, BLOCK_TS the items done in it; both are sampled
+ * until LLP is stable so a block switch in between is not misread.
+ */
+static uint32_t dma_em32_done_bytes(uintptr_t base, uint32_t channel,
+				    const struct dma_em32_channel *ch)
+{
+	uint32_t llp;
+	uint32_t items;
+	uint32_t active;
+	uint32_t done = 0;
+
+	do {
+		llp = DMA_READ(base, DMA_CH_OFF(channel, DMA_CH_LLP));
+		items = DMA_READ(base, DMA_CH_OFF(channel, DMA_CH_CTL_HI)) & CTL_HI_BLOCK_TS_MASK;
+	} while (llp != DMA_READ(base, DMA_CH_OFF(channel, DMA_CH_LLP)));
+
+	active = ch->block_count - 1U;
+	for (uint32_t i = 0; i < ch->block_count; i++) {
+		if (llp == (uint32_t)(uintptr_t)&ch->lli[i]) {
+			active = (i + ch->block_count - 1U) % ch->block_count;
+			break;
+		}
+	}
+
+	for (uint32_t i = 0; i < active; i++) {
+		done += (ch->lli[i].ctl_hi & CTL_HI_BLOCK_TS_MASK) * ch->src_width;
+	}
+
+	return done + MIN(items, ch->lli[active].ctl_hi & CTL_HI_BLOCK_TS_MASK) * ch->src_width;
+}
+
+static int dma_em32_get_status(const struct device *dev, uint32_t channel,
+			       struct dma_status *stat)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	struct dma_em32_data *data = dev->data;
+	struct dma_em32_channel *ch;
+
+	if (channel >= cfg->channels || stat == NULL) {
+		return -EINVAL;
+	}
+
+	ch = &data->chan[channel];
+	memset(stat, 0, sizeof(*stat));
+
+	stat->busy = dma_em32_channel_enabled(cfg->base, channel);
+	stat->dir = ch->direction;
+	stat->total_copied = 0;
+
+	if (stat->busy) {
+		uint32_t done = dma_em32_done_bytes(cfg->base, channel, ch);
+
+		stat->pending_length = ch->total_bytes - MIN(done, ch->total_bytes);
+	}
+
+	return 0;
+}
+
+static int dma_em32_get_attribute(const struct device *dev, uint32_t type, uint32_t *value)
+{
+	ARG_UNUSED(dev);
+
+	switch (type) {
+	case DMA_ATTR_BUFFER_ADDRESS_ALIGNMENT:
+	case DMA_ATTR_BUFFER_SIZE_ALIGNMENT:
+	case DMA_ATTR_COPY_ALIGNMENT:
+		*value = sizeof(uint32_t);
+		return 0;
+	case DMA_ATTR_MAX_BLOCK_COUNT:
+		*value = DMA_EM32_MAX_BLOCKS;
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+static bool dma_em32_chan_filter(const struct device *dev, int channel, void *filter_param)
+{
+	ARG_UNUSED(dev);
+
+	if (filter_param == NULL) {
+		return true;
+	}
+
+	return (*(uint32_t *)filter_param & BIT(channel)) != 0U;
+}
+
+static void dma_em32_isr(const struct device *dev)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	struct dma_em32_data *data = dev->data;
+	uint32_t tfr = DMA_READ(cfg->base, DMA_STATUS_TFR) & 0xFF;
+	uint32_t blk = DMA_READ(cfg->base, DMA_STATUS_BLOCK) & 0xFF;
+	uint32_t err = DMA_READ(cfg->base, DMA_STATUS_ERR) & 0xFF;
+
+	DMA_WRITE(cfg->base, DMA_CLEAR_TFR, tfr);
+	DMA_WRITE(cfg->base, DMA_CLEAR_BLOCK, blk);
+	DMA_WRITE(cfg->base, DMA_CLEAR_ERR, err);
+
+	for (uint32_t channel = 0; channel < cfg->channels; channel++) {
+		struct dma_em32_channel *ch = &data->chan[channel];
+		uint32_t bit = BIT(channel);
+
+		if (err & bit) {
+			ch->busy = false;
+			LOG_ERR("DMA channel %u transfer error", channel);
+			if (ch->callback && ch->error_cb) {
+				ch->callback(dev, ch->user_data, channel, -EIO);
+			}
+			continue;
+		}
+
+		if (tfr & bit) {
+			ch->busy = false;
+			if (ch->callback) {
+				ch->callback(dev, ch->user_data, channel, DMA_STATUS_COMPLETE);
+			}
+			continue;
+		}
+
+		if ((blk & bit) && ch->block_cb && ch->callback) {
+			ch->callback(dev, ch->user_data, channel, DMA_STATUS_BLOCK);
+		}
+	}
+}
+
+static int dma_em32_init(const struct device *dev)
+{
+	const struct dma_em32_config *cfg = dev->config;
+	struct elan_em32_clock_control_subsys clk_subsys = {.clock_group = cfg->clock_group};
+	int ret;
+
+	if (!device_is_ready(cfg->clock_dev)) {
+		LOG_ERR("Clock control device not ready");
+		return -ENODEV;
+	}
+
+	ret = clock_control_on(cfg->clock_dev, (clock_control_subsys_t)&clk_subsys);
+	if (ret < 0) {
+		LOG_ERR("Failed to enable DMA clock: %d", ret);
+		return ret;
+	}
+
+	DMA_WRITE(cfg->base, DMA_CFG_REG, 0);
+
+	/* Mask every source and drop stale status before enabling the controller */
+	for (uint32_t channel = 0; channel < cfg->channels; channel++) {
+		DMA_WRITE(cfg->base, DMA_MASK_TFR, DMA_CH_CLR(channel));
+		DMA_WRITE(cfg->base, DMA_MASK_BLOCK, DMA_CH_CLR(channel));
+		DMA_WRITE(cfg->base, DMA_MASK_SRCTRAN, DMA_CH_CLR(channel));
+		DMA_WRITE(cfg->base, DMA_MASK_DSTTRAN, DMA_CH_CLR(channel));
+		DMA_WRITE(cfg->base, DMA_MASK_ERR, DMA_CH_CLR(channel));
+		dma_em32_irq_clear(cfg->base, channel);
+	}
+
+	/* Route the TFR line explicitly instead of relying on the reset value */
+	sys_write32((sys_read32(DMA_HS_SELECT_REG) & ~DMA_HS_TFR_INT_SEL_MASK) |
+			    DMA_HS_TFR_INT_SEL(cfg->tfr_int_channel),
+		    DMA_HS_SELECT_REG);
+
+	DMA_WRITE(cfg->base, DMA_CFG_REG, BIT(0));
+
+	cfg->irq_config(dev);
+
+	LOG_INF("EM32F967 DMA initialized (%u channels)", cfg->channels);
+
+	return 0;
+}
+
+static DEVICE_API(dma, dma_em32_api) = {
+	.config = dma_em32_configure,
+	.reload = dma_em32_reload,
+	.start = dma_em32_start,
+	.stop = dma_em32_stop,
+	.suspend = dma_em32_suspend,
+	.resume = dma_em32_resume,
+	.get_status = dma_em32_get_status,
+	.get_attribute = dma_em32_get_attribute,
+	.chan_filter = dma_em32_chan_filter,
+};
+
+/* TFR, BLOCK, SRCTRAN, DSTTRAN and ERR each have their own vector, all served by one ISR */
+#define DMA_EM32_IRQ_CONNECT(idx, n)                                                               \
+	IRQ_CONNECT(DT_INST_IRQ_BY_IDX(n, idx, irq), DT_INST_IRQ_BY_IDX(n, idx, priority),         \
+		    dma_em32_isr, DEVICE_DT_INST_GET(n), 0);                                       \
+	irq_enable(DT_INST_IRQ_BY_IDX(n, idx, irq))
+
+#define DMA_EM32_INIT(n)                                                                           \
+	BUILD_ASSERT(DT_INST_PROP(n, dma_channels) <= DMA_EM32_MAX_CHANNELS,                       \
+		     "Too many DMA channels");                                                     \
+                                                                                                   \
+	static void dma_em32_irq_config_##n(const struct device *dev)                              \
+	{                                                                                          \
+		LISTIFY(DT_NUM_IRQS(DT_DRV_INST(n)), DMA_EM32_IRQ_CONNECT, (;), n);                \
+	}                                                                                          \
+                                                                                                   \
+	static const struct dma_em32_config dma_em32_config_##n = {                                \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clock_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                \
+		.clock_group = HCLKG_DMA,                                                          \
+		.channels = DT_INST_PROP(n, dma_channels),                                         \
+		.tfr_int_channel = DT_INST_PROP(n, tfr_int_channel),                               \
+		.irq_config = dma_em32_irq_config_##n,                                             \
+	};                                                                                         \
+                                                                                                   \
+	static struct dma_em32_data dma_em32_data_##n = {                                         \
+		.ctx =                                                                             \
+			{                                                                          \
+				.magic = DMA_MAGIC,                                                \
+				.atomic = dma_em32_data_##n.channels_atomic,                       \
+				.dma_channels = DT_INST_PROP(n, dma_channels),                     \
+			},                                                                         \
+	};                                                                                         \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(n, dma_em32_init, NULL, &dma_em32_data_##n, &dma_em32_config_##n,    \
+			      PRE_KERNEL_1, CONFIG_DMA_INIT_PRIORITY, &dma_em32_api);
+
+DT_INST_FOREACH_STATUS_OKAY(DMA_EM32_INIT)
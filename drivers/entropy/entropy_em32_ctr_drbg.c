@@ -0,0 +1,374 @@
+/*
+ * EM32F967 CTR_DRBG (NIST SP 800-90A) on the ENCRYPT AES core
+ *
+ * AES-256 CTR_DRBG without derivation function. Seed material comes
+ * straight from the TRNG (full entropy), the generate function runs the
+ * AES-256 ECB core of the ENCRYPT block, and a delayable work item
+ * reseeds periodically in the background.
+ *
+ * Copyright (c) 2025 Elan Microelectronics
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT elan_em32_ctr_drbg
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/entropy.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+#include <soc.h>
+#include "../../include/zephyr/drivers/clock_control/clock_control_em32_apb.h"
+#include "../../include/zephyr/drivers/crypto/crypto_em32.h"
+
+LOG_MODULE_REGISTER(entropy_em32_ctr_drbg, CONFIG_ENTROPY_LOG_LEVEL);
+
+/* ENCRYPT block AES register offsets (SHA lives at 0x00-0x30) */
+#define AES_GCTR_OFFSET     0x34
+#define AES_CTR_OFFSET      0x38
+#define AES_KEY_OFFSET      0x4C /* KEY_00..KEY_07, KEY_00 = key[255:224] */
+#define AES_IN_OFFSET       0x6C
+#define AES_OUT_OFFSET      0x70 /* OUT_00..OUT_03, OUT_00 = out[127:96] */
+#define AES_DATALEN_OFFSET  0x80
+
+/* AES_GCTR bits */
+#define AES_GCTR_STR        BIT(0)
+#define AES_GCTR_ECBMODE    BIT(1)
+#define AES_GCTR_DECODE     BIT(2)
+#define AES_GCTR_EXTPKCS    BIT(3)
+#define AES_GCTR_KEYLEN_256 BIT(8)
+
+/* AES_CTR bits */
+#define AES_CTR_INT_CLR     BIT(1)
+#define AES_CTR_RST         BIT(2)
+#define AES_CTR_READY       BIT(3)
+#define AES_CTR_STA         BIT(4)
+
+/* CTR_DRBG parameters for AES-256 (SP 800-90A table 3) */
+#define DRBG_BLOCK_LEN      16
+#define DRBG_KEY_LEN        32
+#define DRBG_SEED_LEN       (DRBG_KEY_LEN + DRBG_BLOCK_LEN)
+#define DRBG_MAX_REQUEST    (1U << 16) /* 2^19 bits per generate */
+
+#define AES_REG(base, off) (*((volatile uint32_t *)((base) + (off))))
+
+struct em32_ctr_drbg_config {
+	/* crypto0: its lock serializes the DRBG with SHA users of the block */
+	const struct device *aes_dev;
+	uintptr_t aes_base;
+	const struct device *clock_dev;
+	const struct device *trng_dev;
+};
+
+/* Key, V and the counter are only touched with the crypto0 lock held */
+struct em32_ctr_drbg_data {
+	uint8_t key[DRBG_KEY_LEN];
+	uint8_t v[DRBG_BLOCK_LEN];
+	uint32_t reseed_counter;
+	bool instantiated;
+#if CONFIG_ENTROPY_EM32_CTR_DRBG_RESEED_INTERVAL_MS > 0
+	const struct device *dev;
+	struct k_work_delayable reseed_work;
+#endif
+};
+
+static void drbg_aes_load_key(uintptr_t base, const uint8_t *key)
+{
+	for (int i = 0; i < DRBG_KEY_LEN / 4; i++) {
+		AES_REG(base, AES_KEY_OFFSET + i * 4) = sys_get_be32(&key[i * 4]);
+	}
+}
+
+/* Encrypt one block with the key currently loaded in AES_KEY_00..07 */
+static int drbg_aes_encrypt_block(uintptr_t base, const uint8_t *in, uint8_t *out)
+{
+	uint32_t timeout = 0;
+
+	AES_REG(base, AES_DATALEN_OFFSET) = DRBG_BLOCK_LEN / 4;
+	AES_REG(base, AES_GCTR_OFFSET) = AES_GCTR_KEYLEN_256 | AES_GCTR_ECBMODE | AES_GCTR_STR;
+
+	for (int i = 0; i < DRBG_BLOCK_LEN / 4; i++) {
+		AES_REG(base, AES_IN_OFFSET) = sys_get_be32(&in[i * 4]);
+	}
+
+	while (!(AES_REG(base, AES_CTR_OFFSET) & AES_CTR_STA)) {
+		if (timeout++ > CONFIG_ENTROPY_EM32_CTR_DRBG_AES_TIMEOUT_USEC) {
+			LOG_ERR("AES block timeout, CTR=0x%08x", AES_REG(base, AES_CTR_OFFSET));
+			return -ETIMEDOUT;
+		}
+		k_busy_wait(1);
+	}
+
+	for (int i = 0; i < DRBG_BLOCK_LEN / 4; i++) {
+		sys_put_be32(AES_REG(base, AES_OUT_OFFSET + i * 4), &out[i * 4]);
+	}
+
+	AES_REG(base, AES_CTR_OFFSET) = AES_CTR_INT_CLR;
+
+	return 0;
+}
+
+/* V = (V + 1) mod 2^128 */
+static void drbg_increment_v(uint8_t *v)
+{
+	for (int i = DRBG_BLOCK_LEN - 1; i >= 0; i--) {
+		if (++v[i] != 0U) {
+			break;
+		}
+	}
+}
+
+/* CTR_DRBG_Update (SP 800-90A 10.2.1.2); provided_data may be NULL (all zero) */
+static int drbg_update(const struct device *dev, const uint8_t *provided_data)
+{
+	const struct em32_ctr_drbg_config *cfg = dev->config;
+	struct em32_ctr_drbg_data *data = dev->data;
+	uint8_t temp[DRBG_SEED_LEN];
+	int ret = 0;
+
+	drbg_aes_load_key(cfg->aes_base, data->key);
+
+	for (int i = 0; i < DRBG_SEED_LEN; i += DRBG_BLOCK_LEN) {
+		drbg_increment_v(data->v);
+		ret = drbg_aes_encrypt_block(cfg->aes_base, data->v, &temp[i]);
+		if (ret < 0) {
+			goto out;
+		}
+	}
+
+	if (provided_data != NULL) {
+		for (int i = 0; i < DRBG_SEED_LEN; i++) {
+			temp[i] ^= provided_data[i];
+		}
+	}
+
+	memcpy(data->key, temp, DRBG_KEY_LEN);
+	memcpy(data->v, &temp[DRBG_KEY_LEN], DRBG_BLOCK_LEN);
+
+out:
+	memset(temp, 0, sizeof(temp));
+	return ret;
+}
+
+/* Reseed (or instantiate, when key/V are zero) from fresh TRNG output */
+static int drbg_reseed_locked(const struct device *dev, const uint8_t *seed)
+{
+	struct em32_ctr_drbg_data *data = dev->data;
+	int ret;
+
+	ret = drbg_update(dev, seed);
+	if (ret < 0) {
+		data->instantiated = false;
+		return ret;
+	}
+
+	data->reseed_counter = 1;
+	data->instantiated = true;
+	return 0;
+}
+
+static int drbg_collect_seed(const struct device *dev, uint8_t *seed)
+{
+	const struct em32_ctr_drbg_config *cfg = dev->config;
+	int ret;
+
+	ret = entropy_get_entropy(cfg->trng_dev, seed, DRBG_SEED_LEN);
+	if (ret < 0) {
+		LOG_ERR("TRNG seed collection failed: %d", ret);
+	}
+	return ret;
+}
+
+static int drbg_reseed(const struct device *dev)
+{
+	const struct em32_ctr_drbg_config *cfg = dev->config;
+	uint8_t seed[DRBG_SEED_LEN];
+	int ret;
+
+	/* Poll the TRNG outside the lock so generate callers are not held up */
+	ret = drbg_collect_seed(dev, seed);
+	if (ret == 0) {
+		crypto_em32_lock(cfg->aes_dev, K_FOREVER);
+		ret = drbg_reseed_locked(dev, seed);
+		crypto_em32_unlock(cfg->aes_dev);
+	}
+
+	memset(seed, 0, sizeof(seed));
+	return ret;
+}
+
+/* CTR_DRBG_Generate (SP 800-90A 10.2.1.5.1) without additional input */
+static int drbg_generate_locked(const struct device *dev, uint8_t *out, size_t len)
+{
+	const struct em32_ctr_drbg_config *cfg = dev->config;
+	struct em32_ctr_drbg_data *data = dev->data;
+	uint8_t block[DRBG_BLOCK_LEN];
+	int ret = 0;
+
+	if (data->reseed_counter > CONFIG_ENTROPY_EM32_CTR_DRBG_RESEED_REQUESTS) {
+		uint8_t seed[DRBG_SEED_LEN];
+
+		LOG_DBG("Reseed interval reached, reseeding inline");
+		ret = drbg_collect_seed(dev, seed);
+		if (ret == 0) {
+			ret = drbg_reseed_locked(dev, seed);
+		}
+		memset(seed, 0, sizeof(seed));
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	drbg_aes_load_key(cfg->aes_base, data->key);
+
+	while (len > 0) {
+		size_t n = MIN(len, (size_t)DRBG_BLOCK_LEN);
+
+		drbg_increment_v(data->v);
+		if (n == DRBG_BLOCK_LEN) {
+			ret = drbg_aes_encrypt_block(cfg->aes_base, data->v, out);
+		} else {
+			ret = drbg_aes_encrypt_block(cfg->aes_base, data->v, block);
+			memcpy(out, block, n);
+		}
+		if (ret < 0) {
+			goto out;
+		}
+		out += n;
+		len -= n;
+	}
+
+	/* Backtracking resistance: roll Key and V forward before returning */
+	ret = drbg_update(dev, NULL);
+	data->reseed_counter++;
+
+out:
+	memset(block, 0, sizeof(block));
+	if (ret < 0) {
+		data->instantiated = false;
+	}
+	return ret;
+}
+
+static int em32_ctr_drbg_get_entropy(const struct device *dev, uint8_t *buffer, uint16_t length)
+{
+	const struct em32_ctr_drbg_config *cfg = dev->config;
+	struct em32_ctr_drbg_data *data = dev->data;
+	int ret = 0;
+
+	crypto_em32_lock(cfg->aes_dev, K_FOREVER);
+
+	if (!data->instantiated) {
+		crypto_em32_unlock(cfg->aes_dev);
+		return -ENODEV;
+	}
+
+	while (length > 0) {
+		uint16_t chunk = (uint16_t)MIN((uint32_t)length, DRBG_MAX_REQUEST - 1U);
+
+		ret = drbg_generate_locked(dev, buffer, chunk);
+		if (ret < 0) {
+			break;
+		}
+		buffer += chunk;
+		length -= chunk;
+	}
+
+	crypto_em32_unlock(cfg->aes_dev);
+	return ret;
+}
+
+#if CONFIG_ENTROPY_EM32_CTR_DRBG_RESEED_INTERVAL_MS > 0
+static void em32_ctr_drbg_reseed_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct em32_ctr_drbg_data *data =
+		CONTAINER_OF(dwork, struct em32_ctr_drbg_data, reseed_work);
+	int ret;
+
+	ret = drbg_reseed(data->dev);
+	if (ret < 0) {
+		LOG_WRN("Background reseed failed: %d", ret);
+	} else {
+		LOG_DBG("Background reseed done");
+	}
+
+	k_work_reschedule(&data->reseed_work,
+			  K_MSEC(CONFIG_ENTROPY_EM32_CTR_DRBG_RESEED_INTERVAL_MS));
+}
+#endif
+
+static int em32_ctr_drbg_init(const struct device *dev)
+{
+	const struct em32_ctr_drbg_config *cfg = dev->config;
+	struct em32_ctr_drbg_data *data = dev->data;
+	struct elan_em32_clock_control_subsys clk_subsys = {
+		.clock_group = HCLKG_ENCRYPT,
+	};
+	uint32_t ctrl;
+	int ret;
+
+	if (!device_is_ready(cfg->trng_dev)) {
+		LOG_ERR("TRNG seed source not ready");
+		return -ENODEV;
+	}
+
+	if (!device_is_ready(cfg->aes_dev) || !device_is_ready(cfg->clock_dev)) {
+		LOG_ERR("AES engine not ready");
+		return -ENODEV;
+	}
+
+	ret = clock_control_on(cfg->clock_dev, &clk_subsys);
+	if (ret < 0) {
+		LOG_ERR("Failed to enable AES clock: %d", ret);
+		return ret;
+	}
+
+	/* Reset the AES core only; the SHA side of the block is untouched */
+	crypto_em32_lock(cfg->aes_dev, K_FOREVER);
+	ctrl = AES_REG(cfg->aes_base, AES_CTR_OFFSET);
+	AES_REG(cfg->aes_base, AES_CTR_OFFSET) = ctrl | AES_CTR_RST;
+	AES_REG(cfg->aes_base, AES_CTR_OFFSET) = ctrl & ~AES_CTR_RST;
+	crypto_em32_unlock(cfg->aes_dev);
+
+	/* Instantiate: Key = 0, V = 0, then Update(entropy_input) */
+	memset(data->key, 0, sizeof(data->key));
+	memset(data->v, 0, sizeof(data->v));
+	ret = drbg_reseed(dev);
+	if (ret < 0) {
+		LOG_ERR("CTR_DRBG instantiate failed: %d", ret);
+		return ret;
+	}
+
+#if CONFIG_ENTROPY_EM32_CTR_DRBG_RESEED_INTERVAL_MS > 0
+	data->dev = dev;
+	k_work_init_delayable(&data->reseed_work, em32_ctr_drbg_reseed_work);
+	k_work_schedule(&data->reseed_work,
+			K_MSEC(CONFIG_ENTROPY_EM32_CTR_DRBG_RESEED_INTERVAL_MS));
+#endif
+
+	LOG_INF("CTR_DRBG instantiated (AES-256, reseed every %u requests)",
+		CONFIG_ENTROPY_EM32_CTR_DRBG_RESEED_REQUESTS);
+	return 0;
+}
+
+static const struct entropy_driver_api em32_ctr_drbg_api = {
+	.get_entropy = em32_ctr_drbg_get_entropy,
+};
+
+#define EM32_CTR_DRBG_INIT(inst) \
+	static struct em32_ctr_drbg_data em32_ctr_drbg_data_##inst; \
+	static const struct em32_ctr_drbg_config em32_ctr_drbg_config_##inst = { \
+		.aes_dev = DEVICE_DT_GET(DT_INST_PHANDLE(inst, aes_engine)), \
+		.aes_base = DT_REG_ADDR(DT_INST_PHANDLE(inst, aes_engine)), \
+		.clock_dev = DEVICE_DT_GET(DT_CLOCKS_CTLR(DT_INST_PHANDLE(inst, aes_engine))), \
+		.trng_dev = DEVICE_DT_GET(DT_INST_PHANDLE(inst, entropy_source)), \
+	}; \
+	DEVICE_DT_INST_DEFINE(inst, em32_ctr_drbg_init, NULL, &em32_ctr_drbg_data_##inst, \
+			      &em32_ctr_drbg_config_##inst, POST_KERNEL, \
+			      CONFIG_ENTROPY_EM32_CTR_DRBG_INIT_PRIORITY, &em32_ctr_drbg_api);
+
+DT_INST_FOREACH_STATUS_OKAY(EM32_CTR_DRBG_INIT)
@@ -31,6 +31,8 @@
 //#include <clock_control_em32_ahb.h>
 #include "../../include/zephyr/drivers/clock_control/clock_control_em32_ahb.h" // delay_10us() & delay_100us()
 
+#include "../../include/zephyr/drivers/dma/dma_em32.h"
+
 /* Log configuration */
 #include <zephyr/logging/log.h>
 //LOG_MODULE_REGISTER(flash_em32, LOG_LEVEL_DBG);
@@ -100,7 +102,8 @@ static int flash_em32_read(const struct device *dev, off_t offset, void *data, s
 
     k_sem_take(&dev_data->mutex, K_FOREVER);
 
-    memcpy(data, (uint8_t *)address, len);
+    // Large reads from the XIP window go through the DMA copy service
+    (void)dma_em32_memcpy(data, (uint8_t *)address, len);
 
     k_sem_give(&dev_data->mutex);
 
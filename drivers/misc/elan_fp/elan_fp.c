@@ -0,0 +1,229 @@
+/*
+ * Elan fingerprint sensor frame capture
+ *
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT elan_fp_sensor
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include <soc.h>
+#include "../../../include/zephyr/drivers/misc/elan_fp.h"
+
+LOG_MODULE_REGISTER(elan_fp, LOG_LEVEL_INF);
+
+/* ID Data RAM spans 0x2000_0000 - 0x2002_7FFF */
+#define ELAN_FP_IDRAM_END (IDRAM_BASE + 0x28000U)
+
+/* Capture requested by the application */
+#define ELAN_FP_RUNNING 0
+/* Capture thread owns the bus and the frame buffers */
+#define ELAN_FP_ACTIVE  1
+
+struct elan_fp_config {
+	struct spi_dt_spec bus;
+	/* Image read command followed by zeroed dummy bytes */
+	const uint8_t *hdr;
+	size_t hdr_len;
+	size_t frame_len;
+	uint8_t *frames[2];
+	k_thread_stack_t *stack;
+	size_t stack_size;
+};
+
+struct elan_fp_data {
+	struct k_thread thread;
+	struct k_sem start;
+	struct k_sem done;
+	atomic_t flags;
+	elan_fp_frame_cb_t cb;
+	void *user_data;
+	int result;
+	struct spi_buf tx_buf;
+	struct spi_buf rx_buf[2];
+	struct spi_buf_set tx_set;
+	struct spi_buf_set rx_set;
+};
+
+static void elan_fp_spi_done(const struct device *spi, int result, void *userdata)
+{
+	struct elan_fp_data *data = userdata;
+
+	ARG_UNUSED(spi);
+
+	data->result = result;
+	k_sem_give(&data->done);
+}
+
+/*
+ * One transaction per frame: the header is clocked out while its echo is
+ * discarded, then the pixels stream straight into the frame buffer. TX is
+ * shorter than RX, so the controller clocks zeros for the pixel phase.
+ */
+static int elan_fp_read_start(const struct device *dev, int idx)
+{
+	const struct elan_fp_config *cfg = dev->config;
+	struct elan_fp_data *data = dev->data;
+
+	data->rx_buf[1].buf = cfg->frames[idx];
+
+	return spi_transceive_cb(cfg->bus.bus, &cfg->bus.config, &data->tx_set, &data->rx_set,
+				 elan_fp_spi_done, data);
+}
+
+static void elan_fp_thread(void *p1, void *p2, void *p3)
+{
+	const struct device *dev = p1;
+	const struct elan_fp_config *cfg = dev->config;
+	struct elan_fp_data *data = dev->data;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		int idx = 0;
+		int ret;
+
+		k_sem_take(&data->start, K_FOREVER);
+		k_sem_reset(&data->done);
+
+		ret = elan_fp_read_start(dev, idx);
+		while (ret == 0) {
+			int ready = idx;
+
+			k_sem_take(&data->done, K_FOREVER);
+			ret = data->result;
+			if (ret < 0 || !atomic_test_bit(&data->flags, ELAN_FP_RUNNING)) {
+				break;
+			}
+
+			/* Put the next frame on the wire before handing this one out */
+			idx ^= 1;
+			ret = elan_fp_read_start(dev, idx);
+
+			data->cb(dev, cfg->frames[ready], cfg->frame_len, 0, data->user_data);
+		}
+
+		if (ret < 0) {
+			LOG_ERR("Frame read failed %d", ret);
+			atomic_clear_bit(&data->flags, ELAN_FP_RUNNING);
+			data->cb(dev, NULL, 0, ret, data->user_data);
+		}
+
+		atomic_clear_bit(&data->flags, ELAN_FP_ACTIVE);
+	}
+}
+
+int elan_fp_capture_start(const struct device *dev, elan_fp_frame_cb_t cb, void *user_data)
+{
+	struct elan_fp_data *data = dev->data;
+
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	if (atomic_test_and_set_bit(&data->flags, ELAN_FP_ACTIVE)) {
+		/* Running, or the last frame of a stopped capture is in flight */
+		return -EALREADY;
+	}
+
+	data->cb = cb;
+	data->user_data = user_data;
+	atomic_set_bit(&data->flags, ELAN_FP_RUNNING);
+	k_sem_give(&data->start);
+
+	return 0;
+}
+
+int elan_fp_capture_stop(const struct device *dev)
+{
+	struct elan_fp_data *data = dev->data;
+
+	if (!atomic_test_and_clear_bit(&data->flags, ELAN_FP_RUNNING)) {
+		return -EALREADY;
+	}
+
+	return 0;
+}
+
+size_t elan_fp_frame_size(const struct device *dev)
+{
+	const struct elan_fp_config *cfg = dev->config;
+
+	return cfg->frame_len;
+}
+
+static int elan_fp_init(const struct device *dev)
+{
+	const struct elan_fp_config *cfg = dev->config;
+	struct elan_fp_data *data = dev->data;
+
+	if (!spi_is_ready_dt(&cfg->bus)) {
+		LOG_ERR("SPI bus %s not ready", cfg->bus.bus->name);
+		return -ENODEV;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(cfg->frames); i++) {
+		uintptr_t start = (uintptr_t)cfg->frames[i];
+
+		if (start < IDRAM_BASE || start + cfg->frame_len > ELAN_FP_IDRAM_END) {
+			LOG_WRN("Frame buffer %p is outside ID Data RAM", cfg->frames[i]);
+		}
+	}
+
+	k_sem_init(&data->start, 0, 1);
+	k_sem_init(&data->done, 0, 1);
+
+	data->tx_buf.buf = (void *)cfg->hdr;
+	data->tx_buf.len = cfg->hdr_len;
+	data->tx_set.buffers = &data->tx_buf;
+	data->tx_set.count = 1;
+
+	data->rx_buf[0].buf = NULL;
+	data->rx_buf[0].len = cfg->hdr_len;
+	data->rx_buf[1].len = cfg->frame_len;
+	data->rx_set.buffers = data->rx_buf;
+	data->rx_set.count = ARRAY_SIZE(data->rx_buf);
+
+	k_thread_create(&data->thread, cfg->stack, cfg->stack_size, elan_fp_thread, (void *)dev,
+			NULL, NULL, K_PRIO_PREEMPT(CONFIG_ELAN_FP_THREAD_PRIORITY), 0, K_NO_WAIT);
+	k_thread_name_set(&data->thread, dev->name);
+
+	return 0;
+}
+
+#define ELAN_FP_HDR_LEN(n) (DT_INST_PROP_LEN(n, image_cmd) + DT_INST_PROP(n, dummy_bytes))
+
+#define ELAN_FP_FRAME_LEN(n)                                                                       \
+	(DT_INST_PROP(n, width) * DT_INST_PROP(n, height) * (DT_INST_PROP(n, bits_per_pixel) / 8))
+
+#define ELAN_FP_INIT(n)                                                                            \
+	static const uint8_t elan_fp_hdr_##n[ELAN_FP_HDR_LEN(n)] = DT_INST_PROP(n, image_cmd);     \
+                                                                                                   \
+	/* Ping-pong frame buffers; no zero-init needed as every frame is overwritten */           \
+	static uint8_t elan_fp_frames_##n[2][ELAN_FP_FRAME_LEN(n)] __aligned(4) __noinit;          \
+                                                                                                   \
+	K_KERNEL_STACK_DEFINE(elan_fp_stack_##n, CONFIG_ELAN_FP_THREAD_STACK_SIZE);               \
+                                                                                                   \
+	static const struct elan_fp_config elan_fp_config_##n = {                                  \
+		.bus = SPI_DT_SPEC_INST_GET(n, SPI_WORD_SET(8) | SPI_TRANSFER_MSB, 0),              \
+		.hdr = elan_fp_hdr_##n,                                                            \
+		.hdr_len = ELAN_FP_HDR_LEN(n),                                                     \
+		.frame_len = ELAN_FP_FRAME_LEN(n),                                                 \
+		.frames = {elan_fp_frames_##n[0], elan_fp_frames_##n[1]},                          \
+		.stack = elan_fp_stack_##n,                                                        \
+		.stack_size = K_KERNEL_STACK_SIZEOF(elan_fp_stack_##n),                            \
+	};                                                                                         \
+                                                                                                   \
+	static struct elan_fp_data elan_fp_data_##n;                                               \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(n, elan_fp_init, NULL, &elan_fp_data_##n, &elan_fp_config_##n,       \
+			      POST_KERNEL, CONFIG_ELAN_FP_INIT_PRIORITY, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(ELAN_FP_INIT)
@@ -1,10 +1,13 @@
 #define DT_DRV_COMPAT elan_elandev_uart
 
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/drivers/clock_control.h>
 #include <zephyr/drivers/pinctrl.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/sys/ring_buffer.h>
 #include "../../include/zephyr/drivers/clock_control/clock_control_em32_apb.h"
 #include <soc.h>
 
@@ -12,17 +15,119 @@
 
 #define UART_STATE_TX_BUSY_MASK BIT(0)
 #define UART_STATE_RX_RDY_MASK  BIT(1)
+#define UART_STATE_RX_OVR_MASK  BIT(3)
+
+#define UART_CTRL_TX_EN     BIT(0)
+#define UART_CTRL_RX_EN     BIT(1)
+#define UART_CTRL_TX_IE     BIT(2)
+#define UART_CTRL_RX_IE     BIT(3)
+#define UART_CTRL_RX_OVR_IE BIT(5)
+
+#define UART_INT_TX     BIT(0)
+#define UART_INT_RX     BIT(1)
+#define UART_INT_RX_OVR BIT(3)
 
 LOG_MODULE_REGISTER(elan967_uart_dev, CONFIG_UART_LOG_LEVEL);
 
+#ifdef CONFIG_UART_ASYNC_API
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+/*
+ * RX DMA runs for as long as RX is enabled: a cyclic list of two blocks
+ * over rx_ring, so one half is copied out while the other one fills. The
+ * UART DMA wrap stops handshaking after DMALENGTH bytes, so its count is
+ * restarted on every block callback, long before it can run out. The wrap
+ * has a single direction bit and stays with RX; TX uses the TX interrupt.
+ */
+#define UART_ELANDEV_DMA_RX_RING_SIZE  CONFIG_UART_ELAN_ELANDEV_DMA_RX_RING_SIZE
+#define UART_ELANDEV_DMA_RX_BLOCK_SIZE (UART_ELANDEV_DMA_RX_RING_SIZE / 2)
+/* DMALENGTHH:DMALENGTHL */
+#define UART_ELANDEV_DMA_WRAP_LENGTH   0xFFFFU
+
+/* BLOCK_TS of the DMA controller is 12 bits wide */
+BUILD_ASSERT(UART_ELANDEV_DMA_RX_RING_SIZE % 2 == 0 &&
+	     UART_ELANDEV_DMA_RX_BLOCK_SIZE <= 4095U,
+	     "RX ring must be two blocks of at most 4095 bytes");
+
+struct uart_elandev_dma_config {
+	const struct device *dev;
+	uint32_t channel;
+	uint32_t slot;
+};
+#endif
+
+struct uart_elandev_async {
+	uart_callback_t cb;
+	void *cb_data;
+
+	const uint8_t *tx_buf;
+	size_t tx_len;
+	size_t tx_pos;
+	bool tx_active;
+	struct k_timer tx_timer;
+
+	uint8_t *rx_buf;
+	size_t rx_len;
+	/* Bytes stored in the current RX buffer */
+	size_t rx_pos;
+	/* Bytes already reported with UART_RX_RDY */
+	size_t rx_offset;
+	/* Received count at the previous idle timer tick */
+	size_t rx_last;
+	uint8_t *rx_next_buf;
+	size_t rx_next_len;
+	bool rx_active;
+	/* RX runs on DMA rather than on the RX interrupt */
+	bool rx_dma;
+	struct k_timer rx_timer;
+
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+	struct dma_config rx_dma_cfg;
+	struct dma_block_config rx_dma_blk[2];
+	/* Ring index up to which received bytes were copied out */
+	size_t rx_ring_tail;
+	uint8_t rx_ring[UART_ELANDEV_DMA_RX_RING_SIZE] __aligned(4);
+#endif
+};
+#endif /* CONFIG_UART_ASYNC_API */
+
 struct uart_elandev_config {
 	uintptr_t base;                 // base address from DTS `reg`
 	const struct device *clock_dev; // clock device reference from DTS "clocks" property
 	const struct pinctrl_dev_config *pcfg;
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN) || defined(CONFIG_UART_ASYNC_API)
+	void (*irq_config)(const struct device *dev);
+#endif
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	unsigned int tx_irq;
+#endif
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+	bool dma_enabled;
+	struct uart_elandev_dma_config dma_rx;
+#endif
 };
 
 struct uart_elandev_data {
 	uint32_t baudrate;
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	/*
+	 * The UART holds a single byte in each direction. The ISR moves bytes
+	 * between the data register and these rings, so the callback only
+	 * runs when there is work for it and RX survives callback latency.
+	 */
+	struct ring_buf rx_ring;
+	struct ring_buf tx_ring;
+	uint8_t rx_buf[CONFIG_UART_ELAN_ELANDEV_RX_RING_SIZE];
+	uint8_t tx_buf[CONFIG_UART_ELAN_ELANDEV_TX_RING_SIZE];
+	uart_irq_callback_user_data_t cb;
+	void *cb_data;
+	bool tx_irq_en;
+	bool rx_irq_en;
+	bool err_irq_en;
+	int err;
+#endif
+#ifdef CONFIG_UART_ASYNC_API
+	struct uart_elandev_async async;
+#endif
 };
 
 static int _uart_poll_in(const struct device *dev, unsigned char *p_char)
@@ -44,6 +149,30 @@ static void _uart_poll_out(const struct device *dev, unsigned char out_char)
 	const struct uart_elandev_config *cfg = dev->config;
 	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
 
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key;
+	uint8_t c;
+
+	/*
+	 * Bytes already queued by fifo_fill() go first. Feed them from here
+	 * rather than wait for the ISR, which cannot run if the caller has
+	 * interrupts locked.
+	 */
+	for (;;) {
+		key = irq_lock();
+		if (!(_uart_console->STATE_U.STATE & UART_STATE_TX_BUSY_MASK)) {
+			if (ring_buf_get(&data->tx_ring, &c, 1) == 0) {
+				break;
+			}
+			_uart_console->DATA = c;
+		}
+		irq_unlock(key);
+	}
+
+	_uart_console->DATA = out_char;
+	irq_unlock(key);
+#else
 	/* Wait until TX is not busy */
 	while (_uart_console->STATE_U.STATE & UART_STATE_TX_BUSY_MASK) {
 		/* spin */
@@ -51,6 +180,7 @@ static void _uart_poll_out(const struct device *dev, unsigned char out_char)
 	}
 
 	_uart_console->DATA = out_char;
+#endif
 }
 
 static int _uart_err_check(const struct device *dev)
@@ -61,17 +191,843 @@ static int _uart_err_check(const struct device *dev)
 
 	int err = 0;
 
-	if (status & BIT(3)) { // RXBUFOVERRUN
+	if (status & UART_STATE_RX_OVR_MASK) { // RXBUFOVERRUN
 		err |= UART_ERROR_OVERRUN;
+		/* Write 1 to clear */
+		_uart_console->STATE_U.STATE = UART_STATE_RX_OVR_MASK;
 	}
 
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+
+	err |= data->err;
+	data->err = 0;
+	irq_unlock(key);
+#endif
+
 	return err;
 }
 
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+
+/* Load the transmit register from the TX ring. Called with interrupts locked. */
+static void _uart_tx_kick(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+	uint8_t c;
+
+	if (!(_uart_console->STATE_U.STATE & UART_STATE_TX_BUSY_MASK) &&
+	    ring_buf_get(&data->tx_ring, &c, 1) == 1) {
+		_uart_console->DATA = c;
+	}
+}
+
+static int _uart_fifo_fill(const struct device *dev, const uint8_t *tx_data, int size)
+{
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+	int len;
+
+	len = ring_buf_put(&data->tx_ring, tx_data, size);
+	_uart_tx_kick(dev);
+	irq_unlock(key);
+
+	return len;
+}
+
+static int _uart_fifo_read(const struct device *dev, uint8_t *rx_data, const int size)
+{
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+	int len;
+
+	len = ring_buf_get(&data->rx_ring, rx_data, size);
+	irq_unlock(key);
+
+	return len;
+}
+
+static int _uart_irq_tx_ready(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	return data->tx_irq_en && ring_buf_space_get(&data->tx_ring) > 0;
+}
+
+static int _uart_irq_tx_complete(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+
+	/* There is no shifter-empty flag: the last byte may still be on the wire */
+	return ring_buf_is_empty(&data->tx_ring) &&
+	       !(_uart_console->STATE_U.STATE & UART_STATE_TX_BUSY_MASK);
+}
+
+static int _uart_irq_rx_ready(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	return !ring_buf_is_empty(&data->rx_ring);
+}
+
+static int _uart_irq_is_pending(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	return _uart_irq_tx_ready(dev) || (data->rx_irq_en && _uart_irq_rx_ready(dev)) ||
+	       (data->err_irq_en && data->err != 0);
+}
+
+static void _uart_run_callback(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	if (data->cb != NULL) {
+		data->cb(dev, data->cb_data);
+	}
+}
+
+static void _uart_irq_driven_isr(const struct device *dev, uint32_t status)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+	uint8_t c;
+
+	if (_uart_console->STATE_U.STATE & UART_STATE_RX_OVR_MASK) {
+		_uart_console->STATE_U.STATE = UART_STATE_RX_OVR_MASK;
+		data->err |= UART_ERROR_OVERRUN;
+	}
+
+	/* With RX interrupts off the byte belongs to poll_in() */
+	if (data->rx_irq_en && (_uart_console->STATE_U.STATE & UART_STATE_RX_RDY_MASK)) {
+		c = _uart_console->DATA & 0xFF;
+		if (ring_buf_put(&data->rx_ring, &c, 1) == 0) {
+			data->err |= UART_ERROR_OVERRUN;
+		}
+	}
+
+	if (status & UART_INT_TX) {
+		_uart_tx_kick(dev);
+	}
+
+	/*
+	 * TX asks for more data only once the ring has run dry. This also
+	 * covers the pass pended by irq_tx_enable(), which has no TX status.
+	 */
+	if ((data->tx_irq_en && ring_buf_is_empty(&data->tx_ring)) ||
+	    (data->rx_irq_en && _uart_irq_rx_ready(dev)) || (data->err_irq_en && data->err != 0)) {
+		_uart_run_callback(dev);
+	}
+}
+
+static void _uart_irq_tx_enable(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+
+	data->tx_irq_en = true;
+	/*
+	 * The TX interrupt is an edge on the holding register emptying. With
+	 * nothing in flight no edge will come, so pend the IRQ to have the
+	 * ISR run the callback.
+	 */
+	if (_uart_irq_tx_complete(dev)) {
+		NVIC_SetPendingIRQ(cfg->tx_irq);
+	}
+	irq_unlock(key);
+}
+
+static void _uart_irq_tx_disable(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	/* Bytes already in the ring still go out */
+	data->tx_irq_en = false;
+}
+
+static void _uart_irq_rx_enable(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+	unsigned int key = irq_lock();
+
+	data->rx_irq_en = true;
+	_uart_console->CTRL |= UART_CTRL_RX_IE;
+	irq_unlock(key);
+}
+
+static void _uart_irq_rx_disable(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+	unsigned int key = irq_lock();
+
+	data->rx_irq_en = false;
+	_uart_console->CTRL &= ~UART_CTRL_RX_IE;
+	irq_unlock(key);
+}
+
+static void _uart_irq_err_enable(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+	unsigned int key = irq_lock();
+
+	data->err_irq_en = true;
+	_uart_console->CTRL |= UART_CTRL_RX_OVR_IE;
+	irq_unlock(key);
+}
+
+static void _uart_irq_err_disable(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+	unsigned int key = irq_lock();
+
+	data->err_irq_en = false;
+	_uart_console->CTRL &= ~UART_CTRL_RX_OVR_IE;
+	irq_unlock(key);
+}
+
+static int _uart_irq_update(const struct device *dev)
+{
+	return 1;
+}
+
+static void _uart_irq_callback_set(const struct device *dev, uart_irq_callback_user_data_t cb,
+				   void *cb_data)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	data->cb = cb;
+	data->cb_data = cb_data;
+}
+
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+
+#ifdef CONFIG_UART_ASYNC_API
+
+static void _uart_async_evt(const struct device *dev, struct uart_event *evt)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	if (data->async.cb != NULL) {
+		data->async.cb(dev, evt, data->async.cb_data);
+	}
+}
+
+static void _uart_rx_buf_done(const struct device *dev);
+
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+static void _uart_dma_callback(const struct device *dma_dev, void *arg, uint32_t channel,
+			       int status);
+
+/* Restart the wrap's byte count; the DMA channel keeps running */
+static void _uart_wrap_arm(UART_TypeDef *_uart_console)
+{
+	_uart_console->DMAENANLE = 0;
+	_uart_console->DMALENGTHL = UART_ELANDEV_DMA_WRAP_LENGTH & 0xFF;
+	_uart_console->DMALENGTHH = (UART_ELANDEV_DMA_WRAP_LENGTH >> 8) & 0xFF;
+	_uart_console->DMAWAITCNT = 0;
+	_uart_console->TXNRX = 0;
+	_uart_console->DMAENANLE = 1;
+}
+
+static int _uart_rx_dma_start(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+	struct dma_config *dma_cfg = &data->async.rx_dma_cfg;
+	int ret;
+
+	memset(dma_cfg, 0, sizeof(struct dma_config));
+	memset(data->async.rx_dma_blk, 0, sizeof(data->async.rx_dma_blk));
+
+	for (size_t i = 0; i < ARRAY_SIZE(data->async.rx_dma_blk); i++) {
+		struct dma_block_config *blk = &data->async.rx_dma_blk[i];
+
+		blk->block_size = UART_ELANDEV_DMA_RX_BLOCK_SIZE;
+		blk->source_address = (uint32_t)&_uart_console->DATA;
+		blk->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		blk->dest_address =
+			(uint32_t)&data->async.rx_ring[i * UART_ELANDEV_DMA_RX_BLOCK_SIZE];
+		blk->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		if (i + 1 < ARRAY_SIZE(data->async.rx_dma_blk)) {
+			blk->next_block = blk + 1;
+		}
+	}
+
+	dma_cfg->channel_direction = PERIPHERAL_TO_MEMORY;
+	dma_cfg->source_data_size = 1;
+	dma_cfg->dest_data_size = 1;
+	dma_cfg->source_burst_length = 1;
+	dma_cfg->dest_burst_length = 1;
+	dma_cfg->block_count = ARRAY_SIZE(data->async.rx_dma_blk);
+	dma_cfg->head_block = data->async.rx_dma_blk;
+	dma_cfg->cyclic = 1;
+	dma_cfg->complete_callback_en = 1;
+	dma_cfg->dma_slot = cfg->dma_rx.slot;
+	dma_cfg->dma_callback = _uart_dma_callback;
+	dma_cfg->user_data = (void *)dev;
+
+	ret = dma_config(cfg->dma_rx.dev, cfg->dma_rx.channel, dma_cfg);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = dma_start(cfg->dma_rx.dev, cfg->dma_rx.channel);
+	if (ret < 0) {
+		return ret;
+	}
+
+	data->async.rx_ring_tail = 0;
+	data->async.rx_dma = true;
+	_uart_wrap_arm(_uart_console);
+
+	return 0;
+}
+
+static void _uart_rx_dma_stop(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+
+	_uart_console->DMAENANLE = 0;
+	dma_stop(cfg->dma_rx.dev, cfg->dma_rx.channel);
+	data->async.rx_dma = false;
+}
+
+/* Ring index the DMA writes next */
+static size_t _uart_rx_dma_head(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	struct dma_status stat;
+
+	if (dma_get_status(cfg->dma_rx.dev, cfg->dma_rx.channel, &stat) < 0 || !stat.busy) {
+		return data->async.rx_ring_tail;
+	}
+
+	return (UART_ELANDEV_DMA_RX_RING_SIZE -
+		MIN(stat.pending_length, UART_ELANDEV_DMA_RX_RING_SIZE)) %
+	       UART_ELANDEV_DMA_RX_RING_SIZE;
+}
+
+/* Move what the DMA has written to the ring into the RX buffers */
+static void _uart_rx_dma_drain(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+	size_t head = _uart_rx_dma_head(dev);
+
+	while (data->async.rx_active && data->async.rx_ring_tail != head) {
+		size_t tail = data->async.rx_ring_tail;
+		size_t len = (head > tail ? head : UART_ELANDEV_DMA_RX_RING_SIZE) - tail;
+
+		len = MIN(len, data->async.rx_len - data->async.rx_pos);
+		memcpy(data->async.rx_buf + data->async.rx_pos, &data->async.rx_ring[tail], len);
+		data->async.rx_pos += len;
+		data->async.rx_ring_tail = (tail + len) % UART_ELANDEV_DMA_RX_RING_SIZE;
+
+		if (data->async.rx_pos == data->async.rx_len) {
+			_uart_rx_buf_done(dev);
+		}
+	}
+}
+#endif /* CONFIG_UART_ELAN_ELANDEV_DMA */
+
+/*
+ * Bytes received into the current RX buffer so far. On DMA this first
+ * empties the ring, which may complete the buffer and move to the next one.
+ */
+static size_t _uart_rx_received(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+	if (data->async.rx_dma) {
+		_uart_rx_dma_drain(dev);
+	}
+#endif
+
+	return data->async.rx_pos;
+}
+
+static void _uart_rx_flush(const struct device *dev, size_t received)
+{
+	struct uart_elandev_data *data = dev->data;
+	struct uart_event evt = {
+		.type = UART_RX_RDY,
+		.data.rx.buf = data->async.rx_buf,
+		.data.rx.offset = data->async.rx_offset,
+		.data.rx.len = received - data->async.rx_offset,
+	};
+
+	if (received > data->async.rx_offset) {
+		data->async.rx_offset = received;
+		_uart_async_evt(dev, &evt);
+	}
+}
+
+/* Start receiving, by DMA when the instance has an RX channel */
+static void _uart_rx_start(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+	if (cfg->dma_enabled) {
+		int ret;
+
+		_uart_console->CTRL &= ~UART_CTRL_RX_IE;
+		ret = _uart_rx_dma_start(dev);
+		if (ret == 0) {
+			return;
+		}
+
+		LOG_ERR("RX DMA start failed %d, using interrupts", ret);
+		_uart_rx_dma_stop(dev);
+	}
+#endif
+
+	_uart_console->CTRL |= UART_CTRL_RX_IE;
+}
+
+static void _uart_rx_halt(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+
+	_uart_console->CTRL &= ~UART_CTRL_RX_IE;
+	k_timer_stop(&data->async.rx_timer);
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+	if (data->async.rx_dma) {
+		_uart_rx_dma_stop(dev);
+	}
+#endif
+	data->async.rx_active = false;
+}
+
+static void _uart_rx_disabled(const struct device *dev)
+{
+	struct uart_event evt = {
+		.type = UART_RX_DISABLED,
+	};
+
+	_uart_async_evt(dev, &evt);
+}
+
+static void _uart_rx_release(const struct device *dev, uint8_t *buf)
+{
+	struct uart_event evt = {
+		.type = UART_RX_BUF_RELEASED,
+		.data.rx_buf.buf = buf,
+	};
+
+	_uart_async_evt(dev, &evt);
+}
+
+static void _uart_rx_request(const struct device *dev)
+{
+	struct uart_event evt = {
+		.type = UART_RX_BUF_REQUEST,
+	};
+
+	_uart_async_evt(dev, &evt);
+}
+
+/* The current RX buffer is full: hand it back and move to the next one */
+static void _uart_rx_buf_done(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	_uart_rx_flush(dev, data->async.rx_len);
+	_uart_rx_release(dev, data->async.rx_buf);
+
+	if (data->async.rx_next_buf == NULL) {
+		_uart_rx_halt(dev);
+		_uart_rx_disabled(dev);
+		return;
+	}
+
+	data->async.rx_buf = data->async.rx_next_buf;
+	data->async.rx_len = data->async.rx_next_len;
+	data->async.rx_next_buf = NULL;
+	data->async.rx_pos = 0;
+	data->async.rx_offset = 0;
+	data->async.rx_last = 0;
+	_uart_rx_request(dev);
+}
+
+/*
+ * There is no idle-line detection in the UART. The timer samples the
+ * received count every timeout period and flushes once it stops moving,
+ * so a partial buffer is reported between one and two periods after the
+ * last byte.
+ */
+static void _uart_rx_timeout(struct k_timer *timer)
+{
+	const struct device *dev = k_timer_user_data_get(timer);
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+	size_t received;
+
+	if (data->async.rx_active) {
+		received = _uart_rx_received(dev);
+		if (received == data->async.rx_last) {
+			_uart_rx_flush(dev, received);
+		}
+		data->async.rx_last = received;
+	}
+
+	irq_unlock(key);
+}
+
+static void _uart_tx_done(const struct device *dev, enum uart_event_type type, size_t len)
+{
+	struct uart_elandev_data *data = dev->data;
+	struct uart_event evt = {
+		.type = type,
+		.data.tx.buf = data->async.tx_buf,
+		.data.tx.len = len,
+	};
+
+	k_timer_stop(&data->async.tx_timer);
+	data->async.tx_active = false;
+	_uart_async_evt(dev, &evt);
+}
+
+/* Send the first byte; the TX interrupt feeds the rest */
+static void _uart_tx_start(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+
+	if (!(_uart_console->STATE_U.STATE & UART_STATE_TX_BUSY_MASK)) {
+		_uart_console->DATA = data->async.tx_buf[data->async.tx_pos++];
+	}
+}
+
+static int _uart_async_tx_abort(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+	size_t sent;
+
+	if (!data->async.tx_active) {
+		irq_unlock(key);
+		return -EFAULT;
+	}
+
+	sent = data->async.tx_pos;
+	_uart_tx_done(dev, UART_TX_ABORTED, sent);
+	irq_unlock(key);
+
+	return 0;
+}
+
+static void _uart_tx_timeout(struct k_timer *timer)
+{
+	_uart_async_tx_abort(k_timer_user_data_get(timer));
+}
+
+static int _uart_async_tx(const struct device *dev, const uint8_t *buf, size_t len,
+			  int32_t timeout)
+{
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key;
+
+	if (buf == NULL || len == 0) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	if (data->async.tx_active) {
+		irq_unlock(key);
+		return -EBUSY;
+	}
+
+	data->async.tx_buf = buf;
+	data->async.tx_len = len;
+	data->async.tx_pos = 0;
+	data->async.tx_active = true;
+
+	_uart_tx_start(dev);
+
+	if (timeout != SYS_FOREVER_US) {
+		k_timer_start(&data->async.tx_timer, K_USEC(timeout), K_NO_WAIT);
+	}
+
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int _uart_async_rx_enable(const struct device *dev, uint8_t *buf, size_t len,
+				 int32_t timeout)
+{
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key;
+
+	if (buf == NULL || len == 0) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	if (data->async.rx_active) {
+		irq_unlock(key);
+		return -EBUSY;
+	}
+
+	data->async.rx_buf = buf;
+	data->async.rx_len = len;
+	data->async.rx_pos = 0;
+	data->async.rx_offset = 0;
+	data->async.rx_last = 0;
+	data->async.rx_next_buf = NULL;
+	data->async.rx_active = true;
+
+	_uart_rx_start(dev);
+
+	if (timeout != SYS_FOREVER_US) {
+		k_timer_start(&data->async.rx_timer, K_USEC(MAX(timeout, 1)),
+			      K_USEC(MAX(timeout, 1)));
+	}
+
+	_uart_rx_request(dev);
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int _uart_async_rx_buf_rsp(const struct device *dev, uint8_t *buf, size_t len)
+{
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+	int ret = 0;
+
+	if (!data->async.rx_active) {
+		ret = -EACCES;
+	} else if (data->async.rx_next_buf != NULL) {
+		ret = -EBUSY;
+	} else if (buf == NULL || len == 0) {
+		ret = -EINVAL;
+	} else {
+		data->async.rx_next_buf = buf;
+		data->async.rx_next_len = len;
+	}
+
+	irq_unlock(key);
+
+	return ret;
+}
+
+static int _uart_async_rx_disable(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+	size_t received;
+
+	if (!data->async.rx_active) {
+		irq_unlock(key);
+		return -EFAULT;
+	}
+
+	/* Stop the handshakes first so the ring stops moving while it is emptied */
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+	if (data->async.rx_dma) {
+		((UART_TypeDef *)cfg->base)->DMAENANLE = 0;
+	}
+#else
+	ARG_UNUSED(cfg);
+#endif
+	received = _uart_rx_received(dev);
+	if (!data->async.rx_active) {
+		/* Emptying the ring used up the last buffer, RX is already off */
+		irq_unlock(key);
+		return 0;
+	}
+	_uart_rx_halt(dev);
+
+	_uart_rx_flush(dev, received);
+	_uart_rx_release(dev, data->async.rx_buf);
+	if (data->async.rx_next_buf != NULL) {
+		_uart_rx_release(dev, data->async.rx_next_buf);
+		data->async.rx_next_buf = NULL;
+	}
+	_uart_rx_disabled(dev);
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int _uart_async_callback_set(const struct device *dev, uart_callback_t callback,
+				    void *user_data)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	data->async.cb = callback;
+	data->async.cb_data = user_data;
+
+	return 0;
+}
+
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+static void _uart_dma_callback(const struct device *dma_dev, void *arg, uint32_t channel,
+			       int status)
+{
+	const struct device *dev = arg;
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	unsigned int key = irq_lock();
+
+	if (!data->async.rx_dma) {
+		irq_unlock(key);
+		return;
+	}
+
+	if (status < 0) {
+		LOG_ERR("RX DMA error %d", status);
+		irq_unlock(key);
+		_uart_async_rx_disable(dev);
+		return;
+	}
+
+	/* One half of the ring is full: keep the wrap counting, then empty it */
+	_uart_wrap_arm((UART_TypeDef *)cfg->base);
+	_uart_rx_dma_drain(dev);
+
+	irq_unlock(key);
+}
+#endif /* CONFIG_UART_ELAN_ELANDEV_DMA */
+
+/* Byte-by-byte path for TX, and for RX when it does not run on DMA */
+static void _uart_async_isr(const struct device *dev, uint32_t status)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	struct uart_elandev_data *data = dev->data;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+
+	if (data->async.rx_active && !data->async.rx_dma &&
+	    (_uart_console->STATE_U.STATE & UART_STATE_RX_RDY_MASK)) {
+		data->async.rx_buf[data->async.rx_pos++] = _uart_console->DATA & 0xFF;
+		if (data->async.rx_pos == data->async.rx_len) {
+			_uart_rx_buf_done(dev);
+		}
+	}
+
+	if (data->async.tx_active && (status & UART_INT_TX)) {
+		if (data->async.tx_pos < data->async.tx_len) {
+			_uart_console->DATA = data->async.tx_buf[data->async.tx_pos++];
+		} else {
+			_uart_tx_done(dev, UART_TX_DONE, data->async.tx_len);
+		}
+	}
+}
+
+static int _uart_async_init(const struct device *dev)
+{
+	struct uart_elandev_data *data = dev->data;
+
+	k_timer_init(&data->async.tx_timer, _uart_tx_timeout, NULL);
+	k_timer_user_data_set(&data->async.tx_timer, (void *)dev);
+	k_timer_init(&data->async.rx_timer, _uart_rx_timeout, NULL);
+	k_timer_user_data_set(&data->async.rx_timer, (void *)dev);
+
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+	const struct uart_elandev_config *cfg = dev->config;
+
+	if (cfg->dma_enabled) {
+		uint32_t ch_filter = BIT(cfg->dma_rx.channel);
+		int ret;
+
+		if (!device_is_ready(cfg->dma_rx.dev)) {
+			LOG_ERR("DMA %s not ready", cfg->dma_rx.dev->name);
+			return -ENODEV;
+		}
+
+		ret = dma_request_channel(cfg->dma_rx.dev, &ch_filter);
+		if (ret < 0) {
+			LOG_ERR("dma_request_channel failed %d", ret);
+			return ret;
+		}
+	}
+#endif
+
+	return 0;
+}
+
+#endif /* CONFIG_UART_ASYNC_API */
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN) || defined(CONFIG_UART_ASYNC_API)
+static void uart_elandev_isr(const struct device *dev)
+{
+	const struct uart_elandev_config *cfg = dev->config;
+	UART_TypeDef *_uart_console = (UART_TypeDef *)cfg->base;
+	uint32_t status = _uart_console->INTSTACLR;
+
+	_uart_console->INTSTACLR = status;
+
+#ifdef CONFIG_UART_ASYNC_API
+	struct uart_elandev_data *data = dev->data;
+
+	if (data->async.cb != NULL) {
+		_uart_async_isr(dev, status);
+		return;
+	}
+#endif
+
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	_uart_irq_driven_isr(dev, status);
+#endif
+}
+#endif
+
 static const struct uart_driver_api uart_elandev_api = {
 	.poll_in = _uart_poll_in,
 	.poll_out = _uart_poll_out,
 	.err_check = _uart_err_check,
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	.fifo_fill = _uart_fifo_fill,
+	.fifo_read = _uart_fifo_read,
+	.irq_tx_enable = _uart_irq_tx_enable,
+	.irq_tx_disable = _uart_irq_tx_disable,
+	.irq_tx_ready = _uart_irq_tx_ready,
+	.irq_tx_complete = _uart_irq_tx_complete,
+	.irq_rx_enable = _uart_irq_rx_enable,
+	.irq_rx_disable = _uart_irq_rx_disable,
+	.irq_rx_ready = _uart_irq_rx_ready,
+	.irq_err_enable = _uart_irq_err_enable,
+	.irq_err_disable = _uart_irq_err_disable,
+	.irq_is_pending = _uart_irq_is_pending,
+	.irq_update = _uart_irq_update,
+	.irq_callback_set = _uart_irq_callback_set,
+#endif
+#ifdef CONFIG_UART_ASYNC_API
+	.callback_set = _uart_async_callback_set,
+	.tx = _uart_async_tx,
+	.tx_abort = _uart_async_tx_abort,
+	.rx_enable = _uart_async_rx_enable,
+	.rx_buf_rsp = _uart_async_rx_buf_rsp,
+	.rx_disable = _uart_async_rx_disable,
+#endif
 };
 
 static int uart_elandev_init(const struct device *dev)
@@ -124,13 +1080,74 @@ static int uart_elandev_init(const struct device *dev)
 
 	_uart_console->BAUDDIV = bauddiv;
 	_uart_console->INTSTACLR = 0xF;
-	_uart_console->CTRL = 3;
+	_uart_console->CTRL = UART_CTRL_TX_EN | UART_CTRL_RX_EN;
+
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	ring_buf_init(&data->rx_ring, sizeof(data->rx_buf), data->rx_buf);
+	ring_buf_init(&data->tx_ring, sizeof(data->tx_buf), data->tx_buf);
+#endif
+
+#ifdef CONFIG_UART_ASYNC_API
+	ret = _uart_async_init(dev);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN) || defined(CONFIG_UART_ASYNC_API)
+	/* TX only fires while a transfer drains, so it can stay enabled */
+	_uart_console->CTRL |= UART_CTRL_TX_IE;
+	cfg->irq_config(dev);
+#endif
 
 	return 0;
 }
 
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN) || defined(CONFIG_UART_ASYNC_API)
+#define UART_ELANDEV_IRQ_CONNECT(index, name)                                                      \
+	IRQ_CONNECT(DT_INST_IRQ_BY_NAME(index, name, irq),                                         \
+		    DT_INST_IRQ_BY_NAME(index, name, priority), uart_elandev_isr,                  \
+		    DEVICE_DT_INST_GET(index), 0);                                                 \
+	irq_enable(DT_INST_IRQ_BY_NAME(index, name, irq))
+
+#define UART_ELANDEV_IRQ_CONFIG(index)                                                             \
+	static void uart_elandev_irq_config_##index(const struct device *dev)                      \
+	{                                                                                          \
+		UART_ELANDEV_IRQ_CONNECT(index, rx);                                               \
+		UART_ELANDEV_IRQ_CONNECT(index, tx);                                               \
+		UART_ELANDEV_IRQ_CONNECT(index, ovf);                                              \
+	}
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+#define UART_ELANDEV_IRQ_CONFIG_INIT(index)                                                        \
+	.irq_config = uart_elandev_irq_config_##index,                                             \
+	.tx_irq = DT_INST_IRQ_BY_NAME(index, tx, irq),
+#else
+#define UART_ELANDEV_IRQ_CONFIG_INIT(index) .irq_config = uart_elandev_irq_config_##index,
+#endif
+#else
+#define UART_ELANDEV_IRQ_CONFIG(index)
+#define UART_ELANDEV_IRQ_CONFIG_INIT(index)
+#endif
+
+#ifdef CONFIG_UART_ELAN_ELANDEV_DMA
+#define UART_ELANDEV_DMA_INITIALIZER(index, dir)                                                   \
+	{                                                                                          \
+		.dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(index, dir)),                       \
+		.channel = DT_INST_DMAS_CELL_BY_NAME(index, dir, channel),                         \
+		.slot = DT_INST_DMAS_CELL_BY_NAME(index, dir, slot),                               \
+	}
+#define UART_ELANDEV_DMA_INIT(index)                                                               \
+	COND_CODE_1(DT_INST_DMAS_HAS_NAME(index, rx),                                              \
+		    (.dma_enabled = true,                                                          \
+		     .dma_rx = UART_ELANDEV_DMA_INITIALIZER(index, rx),),                          \
+		    (.dma_enabled = false,))
+#else
+#define UART_ELANDEV_DMA_INIT(index)
+#endif
+
 #define UART_ELANDEV_INIT(index)                                                                   \
 	PINCTRL_DT_INST_DEFINE(index);                                                             \
+	UART_ELANDEV_IRQ_CONFIG(index)                                                             \
 	static struct uart_elandev_data uart_elandev_data_##index = {                              \
 		.baudrate = DT_INST_PROP(index, current_speed),                                    \
 	};                                                                                         \
@@ -139,6 +1156,8 @@ static int uart_elandev_init(const struct device *dev)
 		.base = DT_INST_REG_ADDR(index),                                                   \
 		.clock_dev = DEVICE_DT_GET(DT_INST_PHANDLE(index, clocks)),                        \
 		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(index),                                     \
+		UART_ELANDEV_IRQ_CONFIG_INIT(index)                                                \
+		UART_ELANDEV_DMA_INIT(index)                                                       \
 	};                                                                                         \
                                                                                                    \
 	DEVICE_DT_INST_DEFINE(index, uart_elandev_init, NULL, /* PM control */                     \
@@ -13,7 +13,15 @@ LOG_MODULE_REGISTER(spi_elandev, CONFIG_SPI_LOG_LEVEL);
 #include <zephyr/drivers/pinctrl.h>
 #include <zephyr/drivers/gpio.h>
 #include <../drivers/spi/spi_context.h>
+#include "spi_pl022_fifo.h"
 #include <zephyr/drivers/clock_control.h>
+#include <zephyr/irq.h>
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+#include <zephyr/drivers/dma.h>
+#endif
+#if defined(CONFIG_SPI_RTIO)
+#include <zephyr/drivers/spi/rtio.h>
+#endif
 #include "../../include/zephyr/drivers/clock_control/clock_control_em32_apb.h"
 
 #define SSP_MASK(regname, name) GENMASK(SSP_##regname##_##name##_MSB, SSP_##regname##_##name##_LSB)
@@ -105,6 +113,62 @@ LOG_MODULE_REGISTER(spi_elandev, CONFIG_SPI_LOG_LEVEL);
 /* Busy Flag */
 #define SSP_SR_MASK_BSY SSP_MASK(SR, BSY)
 
+/*
+ * Interrupt Mask Set or Clear Register
+ */
+#define SSP_IMSC_TXIM_MSB  3
+#define SSP_IMSC_TXIM_LSB  3
+#define SSP_IMSC_RXIM_MSB  2
+#define SSP_IMSC_RXIM_LSB  2
+#define SSP_IMSC_RTIM_MSB  1
+#define SSP_IMSC_RTIM_LSB  1
+#define SSP_IMSC_RORIM_MSB 0
+#define SSP_IMSC_RORIM_LSB 0
+
+/* Receive Overrun Interrupt mask */
+#define SSP_IMSC_MASK_RORIM SSP_MASK(IMSC, RORIM)
+/* Receive timeout Interrupt mask */
+#define SSP_IMSC_MASK_RTIM  SSP_MASK(IMSC, RTIM)
+/* Receive FIFO Interrupt mask (RX FIFO half full) */
+#define SSP_IMSC_MASK_RXIM  SSP_MASK(IMSC, RXIM)
+/* Transmit FIFO Interrupt mask (TX FIFO half empty) */
+#define SSP_IMSC_MASK_TXIM  SSP_MASK(IMSC, TXIM)
+
+/*
+ * Masked Interrupt Status Register
+ */
+#define SSP_MIS_RORMIS_MSB 0
+#define SSP_MIS_RORMIS_LSB 0
+
+/* Receive Overrun Masked Interrupt status */
+#define SSP_MIS_MASK_RORMIS SSP_MASK(MIS, RORMIS)
+
+/*
+ * Interrupt Clear Register
+ */
+#define SSP_ICR_RTIC_MSB  1
+#define SSP_ICR_RTIC_LSB  1
+#define SSP_ICR_RORIC_MSB 0
+#define SSP_ICR_RORIC_LSB 0
+
+/* Receive Overrun Raw Clear Interrupt bit */
+#define SSP_ICR_MASK_RORIC SSP_MASK(ICR, RORIC)
+/* Receive Timeout Clear Interrupt bit */
+#define SSP_ICR_MASK_RTIC  SSP_MASK(ICR, RTIC)
+
+/*
+ * DMA Control Register
+ */
+#define SSP_DMACR_TXDMAE_MSB 1
+#define SSP_DMACR_TXDMAE_LSB 1
+#define SSP_DMACR_RXDMAE_MSB 0
+#define SSP_DMACR_RXDMAE_LSB 0
+
+/* Receive DMA Enable bit */
+#define SSP_DMACR_MASK_RXDMAE SSP_MASK(DMACR, RXDMAE)
+/* Transmit DMA Enable bit */
+#define SSP_DMACR_MASK_TXDMAE SSP_MASK(DMACR, TXDMAE)
+
 /*
  * Clock Parameter ranges
  */
@@ -138,18 +202,63 @@ LOG_MODULE_REGISTER(spi_elandev, CONFIG_SPI_LOG_LEVEL);
 #define MAX_FREQ_CONTROLLER_MODE(pclk) ((pclk) / 2)
 #define MAX_FREQ_PERIPHERAL_MODE(pclk) ((pclk) / 12)
 
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+enum spi_elandev_dma_direction {
+	TX = 0,
+	RX,
+	NUM_OF_DIRECTION
+};
+
+/* BLOCK_TS of the DMA controller is 12 bits wide */
+#define SPI_ELANDEV_DMA_MAX_CHUNK 4095U
+
+struct spi_elandev_dma_config {
+	const struct device *dev;
+	uint32_t channel;
+	uint32_t slot;
+};
+
+struct spi_elandev_dma_data {
+	struct dma_config config;
+	struct dma_block_config block;
+	bool done;
+};
+#endif
+
 struct spi_elandev_config {
 	uintptr_t base;                 // base address from DTS `reg`
 	const struct device *clock_dev; // clock device reference from DTS "clocks" property
 	const struct pinctrl_dev_config *pcfg;
+#if defined(CONFIG_SPI_ELAN_ELANDEV_INTERRUPT)
+	void (*irq_config)(const struct device *dev);
+#endif
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+	bool dma_enabled;
+	struct spi_elandev_dma_config dma[NUM_OF_DIRECTION];
+#endif
 };
 
 struct spi_elandev_data {
 	struct spi_context ctx;
 	uint32_t tx_count;
 	uint32_t rx_count;
+	/* Settings last programmed, to skip rewriting them for a new spi_config */
+	uint32_t cur_frequency;
+	uint16_t cur_operation;
+	bool cur_valid;
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+	struct spi_elandev_dma_data dma[NUM_OF_DIRECTION];
+	size_t dma_chunk;
+#endif
 };
 
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+/* Source of the dummy bytes clocked out for read-only transfers */
+static const uint32_t spi_elandev_dummy_tx;
+/* Sink of received bytes for write-only transfers */
+static uint32_t spi_elandev_dummy_rx;
+#endif
+
 /* Helper Functions */
 
 static inline uint32_t spi_pl022_calc_prescale(const uint32_t pclk, const uint32_t baud)
@@ -198,6 +307,13 @@ static int spi_pl022_configure(const struct device *dev, const struct spi_config
 		return 0;
 	}
 
+	/* Same settings from another spi_config: only the owner and CS change */
+	if (data->cur_valid && data->cur_frequency == spicfg->frequency &&
+	    data->cur_operation == op) {
+		data->ctx.config = spicfg;
+		return 0;
+	}
+
 	/* Enable clock to specified peripheral if clock device is available */
 	if (apb_clk_dev != NULL) {
 		/* Enable clock to specified peripheral */
@@ -270,6 +386,9 @@ static int spi_pl022_configure(const struct device *dev, const struct spi_config
 	SSP_WRITE_REG(SSP_CR1(cfg->base), cr1);
 
 	data->ctx.config = spicfg;
+	data->cur_frequency = spicfg->frequency;
+	data->cur_operation = op;
+	data->cur_valid = true;
 
 	return 0;
 }
@@ -279,18 +398,79 @@ static inline bool spi_pl022_transfer_ongoing(struct spi_elandev_data *data)
 	return spi_context_tx_on(&data->ctx) || spi_context_rx_on(&data->ctx);
 }
 
+#if !defined(CONFIG_SPI_ELAN_ELANDEV_INTERRUPT)
 static void spi_pl022_xfer(const struct device *dev)
 {
 	const struct spi_elandev_config *cfg = dev->config;
 	struct spi_elandev_data *data = dev->data;
 	const size_t chunk_len = spi_context_max_continuous_chunk(&data->ctx);
-	const void *txbuf = data->ctx.tx_buf;
-	void *rxbuf = data->ctx.rx_buf;
-	uint32_t txrx;
-	size_t fifo_cnt = 0;
 
-	data->tx_count = 0;
-	data->rx_count = 0;
+	/* Ensure writable */
+	while (!SSP_TX_FIFO_EMPTY(cfg->base)) {
+		;
+	}
+	/* Drain RX FIFO */
+	while (SSP_RX_FIFO_NOT_EMPTY(cfg->base)) {
+		SSP_READ_REG(SSP_DR(cfg->base));
+	}
+
+	pl022_fifo_xfer(cfg->base, data->ctx.tx_buf, data->ctx.rx_buf, chunk_len, PL022_FRAME_8);
+
+	data->tx_count = chunk_len;
+	data->rx_count = chunk_len;
+}
+#endif /* !CONFIG_SPI_ELAN_ELANDEV_INTERRUPT */
+
+static void spi_e967_complete(const struct device *dev, int status)
+{
+	struct spi_elandev_data *data = dev->data;
+
+	spi_context_cs_control(&data->ctx, false);
+	spi_context_complete(&data->ctx, dev, status);
+}
+
+#if defined(CONFIG_SPI_ELAN_ELANDEV_INTERRUPT)
+
+/*
+ * FIFO watermark mode: at most SSP_FIFO_DEPTH frames are kept in flight so the
+ * RX FIFO cannot overrun. The RX half-full interrupt refills the TX FIFO while
+ * the transfer streams and the RX timeout interrupt collects the tail.
+ */
+static void spi_e967_fifo_service(const struct device *dev)
+{
+	const struct spi_elandev_config *cfg = dev->config;
+	struct spi_elandev_data *data = dev->data;
+	struct spi_context *ctx = &data->ctx;
+	size_t chunk_len = spi_context_max_continuous_chunk(ctx);
+
+	pl022_fifo_step(cfg->base, ctx->tx_buf, ctx->rx_buf, chunk_len, &data->tx_count,
+			&data->rx_count, PL022_FRAME_8);
+
+	while (data->rx_count >= chunk_len) {
+		spi_context_update_tx(ctx, 1, chunk_len);
+		spi_context_update_rx(ctx, 1, chunk_len);
+
+		if (!spi_pl022_transfer_ongoing(data)) {
+			/* All data is processed, complete the process */
+			SSP_WRITE_REG(SSP_IMSC(cfg->base), 0);
+			spi_e967_complete(dev, 0);
+			return;
+		}
+
+		/* Next chunk is available, reset the count and prime the FIFO */
+		data->tx_count = 0;
+		data->rx_count = 0;
+		chunk_len = spi_context_max_continuous_chunk(ctx);
+		pl022_fifo_step(cfg->base, ctx->tx_buf, ctx->rx_buf, chunk_len, &data->tx_count,
+				&data->rx_count, PL022_FRAME_8);
+	}
+}
+
+static void spi_e967_start_fifo_xfer(const struct device *dev)
+{
+	const struct spi_elandev_config *cfg = dev->config;
+	struct spi_elandev_data *data = dev->data;
+	unsigned int key;
 
 	/* Ensure writable */
 	while (!SSP_TX_FIFO_EMPTY(cfg->base)) {
@@ -301,47 +481,212 @@ static void spi_pl022_xfer(const struct device *dev)
 		SSP_READ_REG(SSP_DR(cfg->base));
 	}
 
-	while (data->rx_count < chunk_len || data->tx_count < chunk_len) {
-		/* Fill up fifo with available TX data */
-		while (SSP_TX_FIFO_NOT_FULL(cfg->base) && data->tx_count < chunk_len &&
-		       fifo_cnt < SSP_FIFO_DEPTH) {
-			/* Send 0 in the case of read only operation */
-			txrx = 0;
+	data->tx_count = 0;
+	data->rx_count = 0;
+
+	SSP_WRITE_REG(SSP_ICR(cfg->base), SSP_ICR_MASK_RORIC | SSP_ICR_MASK_RTIC);
+
+	/* Prime the FIFO before the ISR may run */
+	key = irq_lock();
+	SSP_WRITE_REG(SSP_IMSC(cfg->base),
+		      SSP_IMSC_MASK_RORIM | SSP_IMSC_MASK_RTIM | SSP_IMSC_MASK_RXIM);
+	spi_e967_fifo_service(dev);
+	irq_unlock(key);
+}
+
+static void spi_e967_isr(const struct device *dev)
+{
+	const struct spi_elandev_config *cfg = dev->config;
+	uint32_t mis = SSP_READ_REG(SSP_MIS(cfg->base));
+
+	SSP_WRITE_REG(SSP_ICR(cfg->base), SSP_ICR_MASK_RORIC | SSP_ICR_MASK_RTIC);
+
+	if (mis & SSP_MIS_MASK_RORMIS) {
+		LOG_ERR("Receive overrun error");
+		SSP_WRITE_REG(SSP_IMSC(cfg->base), 0);
+		spi_e967_complete(dev, -EIO);
+		return;
+	}
+
+	spi_e967_fifo_service(dev);
+}
+
+#endif /* CONFIG_SPI_ELAN_ELANDEV_INTERRUPT */
 
-			if (txbuf) {
-				txrx = ((uint8_t *)txbuf)[data->tx_count];
-			}
-			SSP_WRITE_REG(SSP_DR(cfg->base), txrx);
-			data->tx_count++;
-			fifo_cnt++;
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+
+static void spi_e967_dma_callback(const struct device *dma_dev, void *arg, uint32_t channel,
+				  int status);
+
+static int spi_e967_dma_setup(const struct device *dev, enum spi_elandev_dma_direction dir,
+			      size_t len)
+{
+	const struct spi_elandev_config *cfg = dev->config;
+	struct spi_elandev_data *data = dev->data;
+	struct dma_config *dma_cfg = &data->dma[dir].config;
+	struct dma_block_config *block_cfg = &data->dma[dir].block;
+	struct spi_context *ctx = &data->ctx;
+
+	memset(dma_cfg, 0, sizeof(struct dma_config));
+	memset(block_cfg, 0, sizeof(struct dma_block_config));
+
+	dma_cfg->source_data_size = 1;
+	dma_cfg->dest_data_size = 1;
+	dma_cfg->source_burst_length = 1;
+	dma_cfg->dest_burst_length = 1;
+	dma_cfg->block_count = 1U;
+	dma_cfg->head_block = block_cfg;
+	dma_cfg->dma_slot = cfg->dma[dir].slot;
+	dma_cfg->dma_callback = spi_e967_dma_callback;
+	dma_cfg->user_data = (void *)dev;
+
+	block_cfg->block_size = len;
+
+	if (dir == TX) {
+		dma_cfg->channel_direction = MEMORY_TO_PERIPHERAL;
+		block_cfg->dest_address = SSP_DR(cfg->base);
+		block_cfg->dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		if (ctx->tx_buf) {
+			block_cfg->source_address = (uint32_t)ctx->tx_buf;
+			block_cfg->source_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		} else {
+			block_cfg->source_address = (uint32_t)&spi_elandev_dummy_tx;
+			block_cfg->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
 		}
-		while (data->rx_count < chunk_len && fifo_cnt > 0) {
-			if (!SSP_RX_FIFO_NOT_EMPTY(cfg->base)) {
-				continue;
-			}
+	} else {
+		dma_cfg->channel_direction = PERIPHERAL_TO_MEMORY;
+		block_cfg->source_address = SSP_DR(cfg->base);
+		block_cfg->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		if (ctx->rx_buf) {
+			block_cfg->dest_address = (uint32_t)ctx->rx_buf;
+			block_cfg->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		} else {
+			block_cfg->dest_address = (uint32_t)&spi_elandev_dummy_rx;
+			block_cfg->dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		}
+	}
 
-			txrx = SSP_READ_REG(SSP_DR(cfg->base));
+	data->dma[dir].done = false;
 
-			/* Discard received data if rx buffer not assigned */
-			if (rxbuf) {
-				((uint8_t *)rxbuf)[data->rx_count] = (uint8_t)txrx;
-			}
-			data->rx_count++;
-			fifo_cnt--;
+	return dma_config(cfg->dma[dir].dev, cfg->dma[dir].channel, dma_cfg);
+}
+
+static void spi_e967_dma_stop(const struct device *dev)
+{
+	const struct spi_elandev_config *cfg = dev->config;
+
+	SSP_WRITE_REG(SSP_DMACR(cfg->base), 0);
+
+	for (size_t i = 0; i < NUM_OF_DIRECTION; i++) {
+		dma_stop(cfg->dma[i].dev, cfg->dma[i].channel);
+	}
+}
+
+/* Returns 1 when there is nothing left to transfer */
+static int spi_e967_dma_start_chunk(const struct device *dev)
+{
+	const struct spi_elandev_config *cfg = dev->config;
+	struct spi_elandev_data *data = dev->data;
+	size_t len = MIN(spi_context_max_continuous_chunk(&data->ctx), SPI_ELANDEV_DMA_MAX_CHUNK);
+	int ret;
+
+	if (len == 0U) {
+		return 1;
+	}
+
+	data->dma_chunk = len;
+
+	SSP_WRITE_REG(SSP_DMACR(cfg->base), 0);
+
+	/* RX is armed first so no received frame is missed once TX starts */
+	ret = spi_e967_dma_setup(dev, RX, len);
+	if (ret == 0) {
+		ret = spi_e967_dma_setup(dev, TX, len);
+	}
+	if (ret == 0) {
+		ret = dma_start(cfg->dma[RX].dev, cfg->dma[RX].channel);
+	}
+	if (ret == 0) {
+		ret = dma_start(cfg->dma[TX].dev, cfg->dma[TX].channel);
+	}
+	if (ret < 0) {
+		LOG_ERR("DMA chunk start failed %d", ret);
+		spi_e967_dma_stop(dev);
+		return ret;
+	}
+
+	SSP_WRITE_REG(SSP_DMACR(cfg->base), SSP_DMACR_MASK_RXDMAE | SSP_DMACR_MASK_TXDMAE);
+
+	return 0;
+}
+
+static void spi_e967_dma_callback(const struct device *dma_dev, void *arg, uint32_t channel,
+				  int status)
+{
+	const struct device *dev = (const struct device *)arg;
+	const struct spi_elandev_config *cfg = dev->config;
+	struct spi_elandev_data *data = dev->data;
+	int ret;
+
+	if (status < 0) {
+		LOG_ERR("dma:%p ch:%d callback gets error: %d", dma_dev, channel, status);
+		spi_e967_dma_stop(dev);
+		spi_e967_complete(dev, status);
+		return;
+	}
+
+	for (size_t i = 0; i < NUM_OF_DIRECTION; i++) {
+		if (dma_dev == cfg->dma[i].dev && channel == cfg->dma[i].channel) {
+			data->dma[i].done = true;
 		}
 	}
+
+	if (!data->dma[TX].done || !data->dma[RX].done) {
+		return;
+	}
+
+	spi_context_update_tx(&data->ctx, 1, data->dma_chunk);
+	spi_context_update_rx(&data->ctx, 1, data->dma_chunk);
+
+	ret = spi_e967_dma_start_chunk(dev);
+	if (ret != 0) {
+		SSP_WRITE_REG(SSP_DMACR(cfg->base), 0);
+		spi_e967_complete(dev, ret < 0 ? ret : 0);
+	}
+}
+
+#endif /* CONFIG_SPI_ELAN_ELANDEV_DMA */
+
+#if defined(CONFIG_SPI_ELAN_ELANDEV_INTERRUPT) || defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+/* Stop whichever engine drives the transfer after a wait timed out */
+static void spi_e967_abort(const struct device *dev)
+{
+	const struct spi_elandev_config *cfg = dev->config;
+	struct spi_elandev_data *data = dev->data;
+
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+	if (cfg->dma_enabled) {
+		spi_e967_dma_stop(dev);
+	}
+#endif
+	SSP_WRITE_REG(SSP_IMSC(cfg->base), 0);
+	spi_context_cs_control(&data->ctx, false);
 }
+#endif
 
-static int transceive_polling(const struct device *dev, const struct spi_config *config,
-			      const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs)
+static int spi_e967_transceive_impl(const struct device *dev, const struct spi_config *config,
+				    const struct spi_buf_set *tx_bufs,
+				    const struct spi_buf_set *rx_bufs, spi_callback_t cb,
+				    void *userdata)
 {
+	const struct spi_elandev_config *cfg = dev->config;
 	struct spi_elandev_data *data = dev->data;
 	struct spi_context *ctx = &data->ctx;
+	size_t len;
 	int ret;
 
 	/* Lock the SPI Context */
-	spi_context_lock(&data->ctx, false /*asynchronous*/, NULL /*cb*/, NULL /*userdata*/,
-			 config);
+	spi_context_lock(ctx, cb != NULL, cb, userdata, config);
 
 	ret = spi_pl022_configure(dev, config);
 	if (ret < 0) {
@@ -349,33 +694,77 @@ static int transceive_polling(const struct device *dev, const struct spi_config
 		goto error;
 	}
 
+	if (cb == NULL && pl022_fifo_tiny_len(tx_bufs, rx_bufs, &len)) {
+		spi_context_cs_control(ctx, true);
+		pl022_fifo_xfer_tiny(cfg->base, tx_bufs, rx_bufs, len);
+		spi_context_cs_control(ctx, false);
+		goto error;
+	}
+
 	spi_context_buffers_setup(ctx, tx_bufs, rx_bufs, 1);
 
 	spi_context_cs_control(ctx, true);
 
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+	if (cfg->dma_enabled) {
+		ret = spi_e967_dma_start_chunk(dev);
+		if (ret < 0) {
+			spi_context_cs_control(ctx, false);
+			goto error;
+		}
+		if (ret > 0) {
+			/* Empty buffer set */
+			spi_e967_complete(dev, 0);
+		}
+		ret = spi_context_wait_for_completion(ctx);
+		if (ret == -ETIMEDOUT) {
+			spi_e967_abort(dev);
+		}
+		goto error;
+	}
+#endif
+
+#if defined(CONFIG_SPI_ELAN_ELANDEV_INTERRUPT)
+	spi_e967_start_fifo_xfer(dev);
+	ret = spi_context_wait_for_completion(ctx);
+	if (ret == -ETIMEDOUT) {
+		spi_e967_abort(dev);
+	}
+#else
 	do {
 		spi_pl022_xfer(dev);
 		spi_context_update_tx(ctx, 1, data->tx_count);
 		spi_context_update_rx(ctx, 1, data->rx_count);
 	} while (spi_pl022_transfer_ongoing(data));
 
-	spi_context_cs_control(&data->ctx, false);
+	if (cb != NULL) {
+		spi_e967_complete(dev, 0);
+	} else {
+		spi_context_cs_control(ctx, false);
+	}
+#endif
 
 error:
-	spi_context_release(&data->ctx, ret);
+	spi_context_release(ctx, ret);
 
-	return 0;
+	return ret;
 }
 
 static int spi_e967_transceive(const struct device *dev, const struct spi_config *config,
 			       const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs)
 {
-	int ret = 0;
-
-	ret = transceive_polling(dev, config, tx_bufs, rx_bufs);
+	return spi_e967_transceive_impl(dev, config, tx_bufs, rx_bufs, NULL, NULL);
+}
 
-	return ret;
+#ifdef CONFIG_SPI_ASYNC
+static int spi_e967_transceive_async(const struct device *dev, const struct spi_config *config,
+				     const struct spi_buf_set *tx_bufs,
+				     const struct spi_buf_set *rx_bufs, spi_callback_t cb,
+				     void *userdata)
+{
+	return spi_e967_transceive_impl(dev, config, tx_bufs, rx_bufs, cb, userdata);
 }
+#endif /* CONFIG_SPI_ASYNC */
 
 static int spi_e967_release(const struct device *dev, const struct spi_config *config)
 {
@@ -388,10 +777,10 @@ static int spi_e967_release(const struct device *dev, const struct spi_config *c
 
 static const struct spi_driver_api spi_elan967_api = {.transceive = spi_e967_transceive,
 #ifdef CONFIG_SPI_ASYNC
-						      .transceive_async = NULL,
+						      .transceive_async = spi_e967_transceive_async,
 #endif /* CONFIG_SPI_ASYNC */
 #ifdef CONFIG_SPI_RTIO
-						      .submit iodev_submit = NULL,
+						      .iodev_submit = spi_rtio_iodev_default_submit,
 #endif /* CONFIG_SPI_RTIO */
 						      .release = spi_e967_release};
 
@@ -419,6 +808,30 @@ static int spi_e967_init(const struct device *dev)
 		return ret;
 	}
 
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+	if (cfg->dma_enabled) {
+		for (size_t i = 0; i < NUM_OF_DIRECTION; i++) {
+			uint32_t ch_filter = BIT(cfg->dma[i].channel);
+
+			if (!device_is_ready(cfg->dma[i].dev)) {
+				LOG_ERR("DMA %s not ready", cfg->dma[i].dev->name);
+				return -ENODEV;
+			}
+
+			ret = dma_request_channel(cfg->dma[i].dev, &ch_filter);
+			if (ret < 0) {
+				LOG_ERR("dma_request_channel failed %d", ret);
+				return ret;
+			}
+		}
+	}
+#endif
+
+#if defined(CONFIG_SPI_ELAN_ELANDEV_INTERRUPT)
+	SSP_WRITE_REG(SSP_IMSC(cfg->base), 0);
+	cfg->irq_config(dev);
+#endif
+
 	/* Make sure the context is unlocked */
 	spi_context_unlock_unconditionally(&data->ctx);
 
@@ -444,8 +857,40 @@ static int spi_e967_init(const struct device *dev)
 	return 0;
 }
 
+#if defined(CONFIG_SPI_ELAN_ELANDEV_INTERRUPT)
+#define ELAN_SPI_IRQ_CONFIG(index)                                                                 \
+	static void spi_e967_irq_config_##index(const struct device *dev)                          \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQN(index), DT_INST_IRQ(index, priority), spi_e967_isr,       \
+			    DEVICE_DT_INST_GET(index), 0);                                         \
+		irq_enable(DT_INST_IRQN(index));                                                   \
+	}
+#define ELAN_SPI_IRQ_CONFIG_INIT(index) .irq_config = spi_e967_irq_config_##index,
+#else
+#define ELAN_SPI_IRQ_CONFIG(index)
+#define ELAN_SPI_IRQ_CONFIG_INIT(index)
+#endif
+
+#if defined(CONFIG_SPI_ELAN_ELANDEV_DMA)
+#define ELAN_SPI_DMA_INITIALIZER(index, dir)                                                       \
+	{                                                                                          \
+		.dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(index, dir)),                       \
+		.channel = DT_INST_DMAS_CELL_BY_NAME(index, dir, channel),                         \
+		.slot = DT_INST_DMAS_CELL_BY_NAME(index, dir, slot),                               \
+	}
+#define ELAN_SPI_DMA_INIT(index)                                                                   \
+	COND_CODE_1(DT_INST_DMAS_HAS_NAME(index, rx),                                              \
+		    (.dma_enabled = true,                                                          \
+		     .dma = {ELAN_SPI_DMA_INITIALIZER(index, tx),                                  \
+			     ELAN_SPI_DMA_INITIALIZER(index, rx)},),                               \
+		    (.dma_enabled = false,))
+#else
+#define ELAN_SPI_DMA_INIT(index)
+#endif
+
 #define ELAN_SPI_INIT(index)                                                                       \
 	PINCTRL_DT_INST_DEFINE(index);                                                             \
+	ELAN_SPI_IRQ_CONFIG(index)                                                                 \
 	static struct spi_elandev_data spi_elandev_data_##index = {                                \
 		SPI_CONTEXT_INIT_LOCK(spi_elandev_data_##index, ctx),                              \
 		SPI_CONTEXT_INIT_SYNC(spi_elandev_data_##index, ctx),                              \
@@ -455,6 +900,8 @@ static int spi_e967_init(const struct device *dev)
 		.base = DT_INST_REG_ADDR(index),                                                   \
 		.clock_dev = DEVICE_DT_GET(DT_INST_PHANDLE(index, clocks)),                        \
 		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(index),                                     \
+		ELAN_SPI_IRQ_CONFIG_INIT(index)                                                    \
+		ELAN_SPI_DMA_INIT(index)                                                           \
 	};                                                                                         \
                                                                                                    \
 	SPI_DEVICE_DT_INST_DEFINE(index, spi_e967_init, NULL, /* PM control */                     \
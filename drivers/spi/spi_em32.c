@@ -20,6 +20,10 @@
 #if defined(CONFIG_SPI_EM32_DMA)
 #include <zephyr/drivers/dma.h>
 #endif
+#if defined(CONFIG_SPI_EM32_TARGET)
+#include <zephyr/drivers/gpio.h>
+#include "../../include/zephyr/drivers/spi/spi_em32.h"
+#endif
 
 #define LOG_LEVEL CONFIG_SPI_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -27,6 +31,7 @@
 LOG_MODULE_REGISTER(spi_em32);
 
 #include "spi_context.h"
+#include "spi_pl022_fifo.h"
 
 #define SSP_MASK(regname, name) GENMASK(SSP_##regname##_##name##_MSB, SSP_##regname##_##name##_LSB)
 
@@ -45,6 +50,10 @@ LOG_MODULE_REGISTER(spi_em32);
 #define SSP_MIS(r)      (r + 0x01C)
 #define SSP_ICR(r)      (r + 0x020)
 #define SSP_DMACR(r)    (r + 0x024)
+#define SSP_WRAP(r)     (r + 0x028)
+
+/* Wrap control: B_ENDIAN swaps the two bytes of a 16-bit frame at the FIFO */
+#define SSP_WRAP_B_ENDIAN BIT(7)
 
 /*
  * Control Register 0
@@ -227,6 +236,11 @@ LOG_MODULE_REGISTER(spi_em32);
 
 /* Fifo depth */
 #define SSP_FIFO_DEPTH 8
+/* Frame sizes supported by the data size select field */
+#define SSP_MIN_WORD_SIZE 4
+#define SSP_MAX_WORD_SIZE 16
+/* DMA burst size: the PL022 raises burst requests at the half-FIFO mark */
+#define SSP_DMA_BURST_FRAMES (SSP_FIFO_DEPTH / 2)
 
 /*
  * Register READ/WRITE macros
@@ -253,18 +267,45 @@ enum spi_em32_dma_direction {
 struct spi_em32_dma_config {
 	const struct device *dev;
 	uint32_t channel;
-	uint32_t channel_config;
 	uint32_t slot;
 };
 
+/* Frames per DMA block: BLOCK_TS of the controller is 12 bits wide */
+#define SPI_EM32_DMA_MAX_FRAMES 4095U
+
 struct spi_em32_dma_data {
 	struct dma_config config;
-	struct dma_block_config block;
-	uint32_t count;
+	struct dma_block_config block[CONFIG_SPI_EM32_DMA_MAX_BLOCKS];
 	bool callbacked;
 };
 #endif
 
+#if defined(CONFIG_SPI_EM32_TARGET)
+struct spi_em32_target {
+	const struct device *dev;
+	struct gpio_callback cs_cb;
+	spi_em32_target_cb_t cb;
+	void *user_data;
+	/* Ring positions are free-running byte counts */
+	volatile uint32_t wraps;
+	uint32_t last_head;
+	uint32_t tail;
+	uint32_t frame_start;
+	/* Ring position and frame length latched at the deasserting edge */
+	uint32_t frame_end;
+	size_t frame_len;
+	const uint8_t *resp;
+	size_t resp_len;
+	/* End-of-frame handling, deferred out of the chip-select ISR */
+	struct k_work frame_work;
+	bool frame_pending;
+	bool in_frame;
+	bool overrun;
+	bool active;
+	uint8_t ring[CONFIG_SPI_EM32_TARGET_RING_SIZE] __aligned(4);
+};
+#endif
+
 /*
  * Max frequency
  */
@@ -291,15 +332,44 @@ struct spi_em32_cfg {
 #if defined(CONFIG_SPI_EM32_DMA)
 	const struct spi_em32_dma_config dma[NUM_OF_DIRECTION];
 #endif
+#if defined(CONFIG_SPI_EM32_TARGET)
+	const struct gpio_dt_spec target_cs;
+#endif
 };
 
 struct spi_em32_data {
 	struct spi_context ctx;
 	uint32_t tx_count;
 	uint32_t rx_count;
+	/* CR0 as programmed by spi_em32_configure() */
+	uint32_t cr0;
+	/* Settings last programmed, to skip rewriting them for a new spi_config */
+	uint32_t cur_frequency;
+	uint16_t cur_operation;
+	bool cur_valid;
+	/* Bytes per frame in memory for the current transfer */
+	uint8_t dfs;
+	/* Even-length 8-bit stream moved as byte-swapped 16-bit frames */
+	bool packed;
 	struct k_spinlock lock;
 #if defined(CONFIG_SPI_EM32_DMA)
 	struct spi_em32_dma_data dma[NUM_OF_DIRECTION];
+	uint32_t dma_max_blocks;
+#endif
+#if defined(CONFIG_SPI_RTIO)
+	struct spi_rtio *rtio_ctx;
+	struct spi_buf rtio_tx_buf;
+	struct spi_buf rtio_rx_buf;
+	struct spi_buf_set rtio_tx_set;
+	struct spi_buf_set rtio_rx_set;
+	/* Completion handoff to the loop in spi_em32_iodev_complete() */
+	struct k_spinlock rtio_lock;
+	bool rtio_running;
+	bool rtio_done;
+	int rtio_status;
+#endif
+#if defined(CONFIG_SPI_EM32_TARGET)
+	struct spi_em32_target target;
 #endif
 };
 
@@ -354,6 +424,13 @@ static int spi_em32_configure(const struct device *dev,
 		return 0;
 	}
 
+	/* Same settings from another spi_config: only the owner and CS change */
+	if (data->cur_valid && data->cur_frequency == spicfg->frequency &&
+	    data->cur_operation == op) {
+		data->ctx.config = spicfg;
+		return 0;
+	}
+
 #if defined(CONFIG_CLOCK_CONTROL)
 	ret = clock_control_get_rate(cfg->clk_dev, cfg->clk_id, &pclk);
 	if (ret < 0 || pclk == 0) {
@@ -361,7 +438,13 @@ static int spi_em32_configure(const struct device *dev,
 	}
 #endif
 
-	if (spicfg->frequency > MAX_FREQ_CONTROLLER_MODE(pclk)) {
+	if (SPI_OP_MODE_GET(op) == SPI_OP_MODE_SLAVE) {
+		if (spicfg->frequency > MAX_FREQ_PERIPHERAL_MODE(pclk)) {
+			LOG_ERR("Frequency is up to %u in peripheral mode.",
+				MAX_FREQ_PERIPHERAL_MODE(pclk));
+			return -ENOTSUP;
+		}
+	} else if (spicfg->frequency > MAX_FREQ_CONTROLLER_MODE(pclk)) {
 		LOG_ERR("Frequency is up to %u in controller mode.",
 			MAX_FREQ_CONTROLLER_MODE(pclk));
 		return -ENOTSUP;
@@ -378,15 +461,15 @@ static int spi_em32_configure(const struct device *dev,
 		return -ENOTSUP;
 	}
 
-	/* Peripheral mode has not been implemented */
-	if (SPI_OP_MODE_GET(op) != SPI_OP_MODE_MASTER) {
+	/* Peripheral mode is only reachable through spi_em32_target_start() */
+	if (SPI_OP_MODE_GET(op) != SPI_OP_MODE_MASTER && !IS_ENABLED(CONFIG_SPI_EM32_TARGET)) {
 		LOG_ERR("Peripheral mode is not supported");
 		return -ENOTSUP;
 	}
 
-	/* Word sizes other than 8 bits has not been implemented */
-	if (SPI_WORD_SIZE_GET(op) != 8) {
-		LOG_ERR("Word sizes other than 8 bits are not supported");
+	/* The PL022 data size select covers 4 to 16 bit frames */
+	if (SPI_WORD_SIZE_GET(op) < SSP_MIN_WORD_SIZE || SPI_WORD_SIZE_GET(op) > SSP_MAX_WORD_SIZE) {
+		LOG_ERR("Word size %u is not supported", SPI_WORD_SIZE_GET(op));
 		return -ENOTSUP;
 	}
 
@@ -404,23 +487,26 @@ static int spi_em32_configure(const struct device *dev,
 	cr1 = 0;
 	cr1 |= SSP_CR1_MASK_SSE; /* Always enable SPI */
 	cr1 |= (op & SPI_MODE_LOOP) ? SSP_CR1_MASK_LBM : 0;
+	cr1 |= (SPI_OP_MODE_GET(op) == SPI_OP_MODE_SLAVE) ? SSP_CR1_MASK_MS : 0;
 
 	/* Disable the SSP before it is reconfigured */
 	SSP_WRITE_REG(SSP_CR1(cfg->reg), 0);
 	SSP_WRITE_REG(SSP_CPSR(cfg->reg), prescale);
 	SSP_WRITE_REG(SSP_CR0(cfg->reg), cr0);
+	data->cr0 = cr0;
 	SSP_WRITE_REG(SSP_CR1(cfg->reg), cr1);
 
 #if defined(CONFIG_SPI_EM32_INTERRUPT)
 	if (!cfg->dma_enabled) {
-		LOG_DBG("Enabling SPI interrupts: RORIM | RTIM | RXIM");
 		SSP_WRITE_REG(SSP_IMSC(cfg->reg),
 			      SSP_IMSC_MASK_RORIM | SSP_IMSC_MASK_RTIM | SSP_IMSC_MASK_RXIM);
-		LOG_DBG("IMSC after enable: 0x%08x", SSP_READ_REG(SSP_IMSC(cfg->reg)));
 	}
 #endif
 
 	data->ctx.config = spicfg;
+	data->cur_frequency = spicfg->frequency;
+	data->cur_operation = op;
+	data->cur_valid = true;
 
 	return 0;
 }
@@ -430,6 +516,129 @@ static inline bool spi_em32_transfer_ongoing(struct spi_em32_data *data)
 	return spi_context_tx_on(&data->ctx) || spi_context_rx_on(&data->ctx);
 }
 
+/* CR0 may only change while the SSP is disabled */
+static inline void spi_em32_set_cr0(const struct spi_em32_cfg *cfg, uint32_t cr0)
+{
+	if (SSP_READ_REG(SSP_CR0(cfg->reg)) != cr0) {
+		uint32_t cr1 = SSP_READ_REG(SSP_CR1(cfg->reg));
+
+		SSP_WRITE_REG(SSP_CR1(cfg->reg), cr1 & ~SSP_CR1_MASK_SSE);
+		SSP_WRITE_REG(SSP_CR0(cfg->reg), cr0);
+		SSP_WRITE_REG(SSP_CR1(cfg->reg), cr1);
+	}
+}
+
+static inline bool spi_em32_bufs_even(const struct spi_buf_set *bufs)
+{
+	if (bufs == NULL) {
+		return true;
+	}
+
+	for (size_t i = 0; i < bufs->count; i++) {
+		if (bufs->buffers[i].len & 1U) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Select the in-memory frame size for a transfer. Frames wider than 8 bits
+ * are stored as uint16_t. With CONFIG_SPI_EM32_PACK_16BIT an 8-bit
+ * transfer whose buffers all have even length is clocked as 16-bit frames,
+ * halving FIFO accesses; the byte pair is swapped on the way through the
+ * FIFO so the wire order is unchanged. The CPU paths swap in software; DMA
+ * packs only with CONFIG_SPI_EM32_PACK_16BIT_DMA, where the wrap's
+ * B_ENDIAN bit does the swap.
+ */
+static void spi_em32_set_swap(const struct spi_em32_cfg *cfg, bool swap)
+{
+	uint32_t wrap = SSP_READ_REG(SSP_WRAP(cfg->reg));
+
+	wrap = swap ? (wrap | SSP_WRAP_B_ENDIAN) : (wrap & ~SSP_WRAP_B_ENDIAN);
+	SSP_WRITE_REG(SSP_WRAP(cfg->reg), wrap);
+}
+
+static void spi_em32_setup_frames(const struct device *dev, const struct spi_buf_set *tx_bufs,
+				  const struct spi_buf_set *rx_bufs)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	const uint32_t word_size = SPI_WORD_SIZE_GET(data->ctx.config->operation);
+	uint32_t cr0 = data->cr0;
+
+	data->packed = IS_ENABLED(CONFIG_SPI_EM32_PACK_16BIT) && word_size == 8 &&
+		       (!cfg->dma_enabled || IS_ENABLED(CONFIG_SPI_EM32_PACK_16BIT_DMA)) &&
+		       spi_em32_bufs_even(tx_bufs) && spi_em32_bufs_even(rx_bufs);
+	data->dfs = (word_size > 8 || data->packed) ? 2 : 1;
+
+	if (data->packed) {
+		cr0 = (cr0 & ~SSP_CR0_MASK_DSS) | (SSP_MAX_WORD_SIZE - 1);
+	}
+
+	if (IS_ENABLED(CONFIG_SPI_EM32_PACK_16BIT_DMA)) {
+		spi_em32_set_swap(cfg, data->packed && cfg->dma_enabled);
+	}
+
+	spi_em32_set_cr0(cfg, cr0);
+}
+
+/* Transfers of at most one FIFO of 8-bit frames bypass the context engine */
+static bool spi_em32_tiny_len(const struct spi_em32_data *data,
+			      const struct spi_buf_set *tx_bufs,
+			      const struct spi_buf_set *rx_bufs, size_t *len)
+{
+	if (SPI_WORD_SIZE_GET(data->ctx.config->operation) > 8) {
+		return false;
+	}
+
+	return pl022_fifo_tiny_len(tx_bufs, rx_bufs, len);
+}
+
+static void spi_em32_xfer_tiny(const struct device *dev, const struct spi_buf_set *tx_bufs,
+			       const struct spi_buf_set *rx_bufs, size_t len)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+
+	data->packed = false;
+	data->dfs = 1;
+	if (IS_ENABLED(CONFIG_SPI_EM32_PACK_16BIT_DMA)) {
+		spi_em32_set_swap(cfg, false);
+	}
+	spi_em32_set_cr0(cfg, data->cr0);
+
+	pl022_fifo_xfer_tiny(cfg->reg, tx_bufs, rx_bufs, len);
+}
+
+static inline enum pl022_frame spi_em32_frame_fmt(const struct spi_em32_data *data)
+{
+	if (data->dfs == 1) {
+		return PL022_FRAME_8;
+	}
+
+	return data->packed ? PL022_FRAME_16_BE : PL022_FRAME_16;
+}
+
+#if defined(CONFIG_SPI_RTIO)
+static void spi_em32_iodev_complete(const struct device *dev, int status);
+#endif
+
+/* Report a finished transfer to the RTIO queue or to the waiting caller */
+static inline void spi_em32_xfer_done(const struct device *dev, int status)
+{
+	struct spi_em32_data *data = dev->data;
+
+#if defined(CONFIG_SPI_RTIO)
+	if (data->rtio_ctx->txn_head != NULL) {
+		spi_em32_iodev_complete(dev, status);
+		return;
+	}
+#endif
+	spi_context_complete(&data->ctx, dev, status);
+}
+
 #if defined(CONFIG_SPI_EM32_DMA)
 static void spi_em32_dma_callback(const struct device *dma_dev, void *arg, uint32_t channel,
 				   int status);
@@ -441,92 +650,127 @@ static size_t spi_em32_dma_enabled_num(const struct device *dev)
 	return cfg->dma_enabled ? 2 : 0;
 }
 
-static uint32_t spi_em32_dma_setup(const struct device *dev, const uint32_t dir)
+/*
+ * Walk the spi_buf_set once and emit matching TX and RX block lists: every
+ * block boundary falls where either side changes buffer, so both channels
+ * carry the same frame count per block. The context is advanced as blocks
+ * are emitted; anything that does not fit in one list is picked up by the
+ * next window from the completion callback.
+ */
+static uint32_t spi_em32_dma_build_lists(const struct device *dev)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	struct spi_context *ctx = &data->ctx;
+	struct dma_block_config *tx_blk = data->dma[TX].block;
+	struct dma_block_config *rx_blk = data->dma[RX].block;
+	const uint8_t dfs = data->dfs;
+	uint32_t count = 0;
+
+	while (spi_em32_transfer_ongoing(data) && count < data->dma_max_blocks) {
+		size_t frames = MIN(spi_context_max_continuous_chunk(ctx), SPI_EM32_DMA_MAX_FRAMES);
+
+		memset(&tx_blk[count], 0, sizeof(tx_blk[count]));
+		memset(&rx_blk[count], 0, sizeof(rx_blk[count]));
+
+		tx_blk[count].block_size = frames * dfs;
+		tx_blk[count].dest_address = SSP_DR(cfg->reg);
+		tx_blk[count].dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		if (spi_context_tx_buf_on(ctx)) {
+			tx_blk[count].source_address = (uint32_t)ctx->tx_buf;
+			tx_blk[count].source_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		} else {
+			tx_blk[count].source_address = (uint32_t)&dummy_tx;
+			tx_blk[count].source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		}
+
+		rx_blk[count].block_size = frames * dfs;
+		rx_blk[count].source_address = SSP_DR(cfg->reg);
+		rx_blk[count].source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		if (spi_context_rx_buf_on(ctx)) {
+			rx_blk[count].dest_address = (uint32_t)ctx->rx_buf;
+			rx_blk[count].dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		} else {
+			rx_blk[count].dest_address = (uint32_t)&dummy_rx;
+			rx_blk[count].dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		}
+
+		if (count > 0U) {
+			tx_blk[count - 1U].next_block = &tx_blk[count];
+			rx_blk[count - 1U].next_block = &rx_blk[count];
+		}
+
+		spi_context_update_tx(ctx, dfs, frames);
+		spi_context_update_rx(ctx, dfs, frames);
+		count++;
+	}
+
+	return count;
+}
+
+static int spi_em32_dma_setup(const struct device *dev, const uint32_t dir,
+			      uint32_t block_count)
 {
 	const struct spi_em32_cfg *cfg = dev->config;
 	struct spi_em32_data *data = dev->data;
 	struct dma_config *dma_cfg = &data->dma[dir].config;
-	struct dma_block_config *block_cfg = &data->dma[dir].block;
 	const struct spi_em32_dma_config *dma = &cfg->dma[dir];
+	const uint8_t dfs = data->dfs;
 	int ret;
 
 	memset(dma_cfg, 0, sizeof(struct dma_config));
-	memset(block_cfg, 0, sizeof(struct dma_block_config));
 
-	dma_cfg->source_burst_length = 1;
-	dma_cfg->dest_burst_length = 1;
+	/* Bursts follow the PL022 DMA request watermark (half the FIFO) */
+	dma_cfg->source_burst_length = SSP_DMA_BURST_FRAMES * dfs;
+	dma_cfg->dest_burst_length = SSP_DMA_BURST_FRAMES * dfs;
+	dma_cfg->source_data_size = dfs;
+	dma_cfg->dest_data_size = dfs;
 	dma_cfg->user_data = (void *)dev;
-	dma_cfg->block_count = 1U;
-	dma_cfg->head_block = block_cfg;
+	dma_cfg->block_count = block_count;
+	dma_cfg->head_block = data->dma[dir].block;
 	dma_cfg->dma_slot = cfg->dma[dir].slot;
 	dma_cfg->channel_direction = dir == TX ? MEMORY_TO_PERIPHERAL : PERIPHERAL_TO_MEMORY;
-
-	if (SPI_WORD_SIZE_GET(data->ctx.config->operation) == 8) {
-		dma_cfg->source_data_size = 1;
-		dma_cfg->dest_data_size = 1;
-	} else {
-		dma_cfg->source_data_size = 2;
-		dma_cfg->dest_data_size = 2;
-	}
-
-	block_cfg->block_size = spi_context_max_continuous_chunk(&data->ctx);
-
-	if (dir == TX) {
-		dma_cfg->dma_callback = spi_em32_dma_callback;
-		block_cfg->dest_address = SSP_DR(cfg->reg);
-		block_cfg->dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
-		if (spi_context_tx_buf_on(&data->ctx)) {
-			block_cfg->source_address = (uint32_t)data->ctx.tx_buf;
-			block_cfg->source_addr_adj = DMA_ADDR_ADJ_INCREMENT;
-		} else {
-			block_cfg->source_address = (uint32_t)&dummy_tx;
-			block_cfg->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
-		}
-	}
-
-	if (dir == RX) {
-		dma_cfg->dma_callback = spi_em32_dma_callback;
-		block_cfg->source_address = SSP_DR(cfg->reg);
-		block_cfg->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
-
-		if (spi_context_rx_buf_on(&data->ctx)) {
-			block_cfg->dest_address = (uint32_t)data->ctx.rx_buf;
-			block_cfg->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
-		} else {
-			block_cfg->dest_address = (uint32_t)&dummy_rx;
-			block_cfg->dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
-		}
-	}
+	dma_cfg->dma_callback = spi_em32_dma_callback;
 
 	ret = dma_config(dma->dev, dma->channel, dma_cfg);
 	if (ret < 0) {
-		LOG_ERR("dma_config %p failed %d\n", dma->dev, ret);
+		LOG_ERR("dma_config %p failed %d", dma->dev, ret);
 		return ret;
 	}
 
 	data->dma[dir].callbacked = false;
 
-	ret = dma_start(dma->dev, dma->channel);
-	if (ret < 0) {
-		LOG_ERR("dma_start %p failed %d\n", dma->dev, ret);
-		return ret;
-	}
-
 	return 0;
 }
 
+/* Returns 1 when the buffer set is exhausted and nothing was started */
 static int spi_em32_start_dma_transceive(const struct device *dev)
 {
 	const struct spi_em32_cfg *cfg = dev->config;
+	uint32_t block_count;
 	int ret = 0;
 
 	SSP_CLEAR_REG(SSP_DMACR(cfg->reg), SSP_DMACR_MASK_RXDMAE | SSP_DMACR_MASK_TXDMAE);
 
-	for (size_t i = 0; i < spi_em32_dma_enabled_num(dev); i++) {
-		ret = spi_em32_dma_setup(dev, i);
-		if (ret < 0) {
-			goto on_error;
-		}
+	block_count = spi_em32_dma_build_lists(dev);
+	if (block_count == 0U) {
+		return 1;
+	}
+
+	/* RX is armed before TX so the first received frame has a sink */
+	ret = spi_em32_dma_setup(dev, RX, block_count);
+	if (ret == 0) {
+		ret = spi_em32_dma_setup(dev, TX, block_count);
+	}
+	if (ret == 0) {
+		ret = dma_start(cfg->dma[RX].dev, cfg->dma[RX].channel);
+	}
+	if (ret == 0) {
+		ret = dma_start(cfg->dma[TX].dev, cfg->dma[TX].channel);
+	}
+	if (ret < 0) {
+		LOG_ERR("dma start failed %d", ret);
+		goto on_error;
 	}
 
 	SSP_WRITE_REG(SSP_DMACR(cfg->reg), SSP_DMACR_MASK_RXDMAE | SSP_DMACR_MASK_TXDMAE);
@@ -540,25 +784,18 @@ on_error:
 	return ret;
 }
 
-static bool spi_em32_chunk_transfer_finished(const struct device *dev)
-{
-	struct spi_em32_data *data = dev->data;
-	struct spi_em32_dma_data *dma = data->dma;
-	const size_t chunk_len = spi_context_max_continuous_chunk(&data->ctx);
-
-	return (MIN(dma[TX].count, dma[RX].count) >= chunk_len);
-}
-
 static void spi_em32_complete(const struct device *dev, int status)
 {
 	struct spi_em32_data *data = dev->data;
 	const struct spi_em32_cfg *cfg = dev->config;
 
+	SSP_CLEAR_REG(SSP_DMACR(cfg->reg), SSP_DMACR_MASK_RXDMAE | SSP_DMACR_MASK_TXDMAE);
+
 	for (size_t i = 0; i < spi_em32_dma_enabled_num(dev); i++) {
 		dma_stop(cfg->dma[i].dev, cfg->dma[i].channel);
 	}
 
-	spi_context_complete(&data->ctx, dev, status);
+	spi_em32_xfer_done(dev, status);
 }
 
 static void spi_em32_dma_callback(const struct device *dma_dev, void *arg, uint32_t channel,
@@ -567,10 +804,8 @@ static void spi_em32_dma_callback(const struct device *dma_dev, void *arg, uint3
 	const struct device *dev = (const struct device *)arg;
 	const struct spi_em32_cfg *cfg = dev->config;
 	struct spi_em32_data *data = dev->data;
-	bool complete = false;
 	k_spinlock_key_t key;
-	size_t chunk_len;
-	int err = 0;
+	int err;
 
 	if (status < 0) {
 		key = k_spin_lock(&data->lock);
@@ -582,52 +817,27 @@ static void spi_em32_dma_callback(const struct device *dma_dev, void *arg, uint3
 		return;
 	}
 
+	if (status != DMA_STATUS_COMPLETE) {
+		return;
+	}
+
 	key = k_spin_lock(&data->lock);
 
-	chunk_len = spi_context_max_continuous_chunk(&data->ctx);
 	for (size_t i = 0; i < ARRAY_SIZE(cfg->dma); i++) {
 		if (dma_dev == cfg->dma[i].dev && channel == cfg->dma[i].channel) {
-			data->dma[i].count += chunk_len;
 			data->dma[i].callbacked = true;
 		}
 	}
-	/* Check transfer finished.
-	 * The transmission of this chunk is complete if both the dma[TX].count
-	 * and the dma[RX].count reach greater than or equal to the chunk_len.
-	 * chunk_len is zero here means the transfer is already complete.
-	 */
-	if (spi_em32_chunk_transfer_finished(dev)) {
-		if (SPI_WORD_SIZE_GET(data->ctx.config->operation) == 8) {
-			spi_context_update_tx(&data->ctx, 1, chunk_len);
-			spi_context_update_rx(&data->ctx, 1, chunk_len);
-		} else {
-			spi_context_update_tx(&data->ctx, 2, chunk_len);
-			spi_context_update_rx(&data->ctx, 2, chunk_len);
-		}
-
-		if (spi_em32_transfer_ongoing(data)) {
-			/* Next chunk is available, reset the count and
-			 * continue processing
-			 */
-			data->dma[TX].count = 0;
-			data->dma[RX].count = 0;
-		} else {
-			/* All data is processed, complete the process */
-			complete = true;
-		}
-	}
 
-	if (!complete && data->dma[TX].callbacked && data->dma[RX].callbacked) {
+	/* The whole block list went out once both channels have finished */
+	if (data->dma[TX].callbacked && data->dma[RX].callbacked) {
 		err = spi_em32_start_dma_transceive(dev);
-		if (err) {
-			complete = true;
+		if (err != 0) {
+			/* All data is processed (err > 0) or the restart failed */
+			spi_em32_complete(dev, MIN(err, 0));
 		}
 	}
 
-	if (complete) {
-		spi_em32_complete(dev, err);
-	}
-
 	k_spin_unlock(&data->lock, key);
 }
 
@@ -642,53 +852,26 @@ static void spi_em32_async_xfer(const struct device *dev)
 	struct spi_context *ctx = &data->ctx;
 	/* Process by per chunk */
 	size_t chunk_len = spi_context_max_continuous_chunk(ctx);
-	uint32_t txrx;
 
-	/* Read RX FIFO */
-	while (SSP_RX_FIFO_NOT_EMPTY(cfg->reg) && (data->rx_count < chunk_len)) {
-		txrx = SSP_READ_REG(SSP_DR(cfg->reg));
-
-		/* Discard received data if rx buffer not assigned */
-		if (ctx->rx_buf) {
-			*(((uint8_t *)ctx->rx_buf) + data->rx_count) = (uint8_t)txrx;
-		}
-		data->rx_count++;
-	}
+	pl022_fifo_step(cfg->reg, ctx->tx_buf, ctx->rx_buf, chunk_len, &data->tx_count,
+			&data->rx_count, spi_em32_frame_fmt(data));
 
-	/* Check transfer finished.
-	 * The transmission of this chunk is complete if both the tx_count
-	 * and the rx_count reach greater than or equal to the chunk_len.
-	 * chunk_len is zero here means the transfer is already complete.
-	 */
-	if (MIN(data->tx_count, data->rx_count) >= chunk_len && chunk_len > 0) {
-		spi_context_update_tx(ctx, 1, chunk_len);
-		spi_context_update_rx(ctx, 1, chunk_len);
-		if (spi_em32_transfer_ongoing(data)) {
-			/* Next chunk is available, reset the count and continue processing */
-			data->tx_count = 0;
-			data->rx_count = 0;
-			chunk_len = spi_context_max_continuous_chunk(ctx);
-		} else {
+	/* A chunk is complete once all of its frames were received */
+	while (data->rx_count >= chunk_len) {
+		spi_context_update_tx(ctx, data->dfs, chunk_len);
+		spi_context_update_rx(ctx, data->dfs, chunk_len);
+		if (!spi_em32_transfer_ongoing(data)) {
 			/* All data is processed, complete the process */
-			spi_context_complete(ctx, dev, 0);
+			spi_em32_xfer_done(dev, 0);
 			return;
 		}
-	}
-
-	/* Fill up TX FIFO */
-	for (uint32_t i = 0; i < SSP_FIFO_DEPTH; i++) {
-		if ((data->tx_count < chunk_len) && SSP_TX_FIFO_NOT_FULL(cfg->reg)) {
-			/* Send 0 in the case of read only operation */
-			txrx = 0;
 
-			if (ctx->tx_buf) {
-				txrx = *(((uint8_t *)ctx->tx_buf) + data->tx_count);
-			}
-			SSP_WRITE_REG(SSP_DR(cfg->reg), txrx);
-			data->tx_count++;
-		} else {
-			break;
-		}
+		/* Next chunk is available, reset the count and prime the FIFO */
+		data->tx_count = 0;
+		data->rx_count = 0;
+		chunk_len = spi_context_max_continuous_chunk(ctx);
+		pl022_fifo_step(cfg->reg, ctx->tx_buf, ctx->rx_buf, chunk_len, &data->tx_count,
+				&data->rx_count, spi_em32_frame_fmt(data));
 	}
 }
 
@@ -719,18 +902,12 @@ static void spi_em32_start_async_xfer(const struct device *dev)
 static void spi_em32_isr(const struct device *dev)
 {
 	const struct spi_em32_cfg *cfg = dev->config;
-	struct spi_em32_data *data = dev->data;
-	struct spi_context *ctx = &data->ctx;
 	uint32_t mis = SSP_READ_REG(SSP_MIS(cfg->reg));
-	uint32_t sr = SSP_READ_REG(SSP_SR(cfg->reg));
-	uint32_t ris = SSP_READ_REG(SSP_RIS(cfg->reg));
-
-	LOG_DBG("ISR: MIS=0x%08x, SR=0x%08x, RIS=0x%08x", mis, sr, ris);
 
 	if (mis & SSP_MIS_MASK_RORMIS) {
 		LOG_ERR("Receive overrun error");
 		SSP_WRITE_REG(SSP_IMSC(cfg->reg), 0);
-		spi_context_complete(ctx, dev, -EIO);
+		spi_em32_xfer_done(dev, -EIO);
 	} else {
 		spi_em32_async_xfer(dev);
 	}
@@ -745,13 +922,6 @@ static void spi_em32_xfer(const struct device *dev)
 	const struct spi_em32_cfg *cfg = dev->config;
 	struct spi_em32_data *data = dev->data;
 	const size_t chunk_len = spi_context_max_continuous_chunk(&data->ctx);
-	const void *txbuf = data->ctx.tx_buf;
-	void *rxbuf = data->ctx.rx_buf;
-	uint32_t txrx;
-	size_t fifo_cnt = 0;
-
-	data->tx_count = 0;
-	data->rx_count = 0;
 
 	/* Ensure writable */
 	while (!SSP_TX_FIFO_EMPTY(cfg->reg)) {
@@ -762,39 +932,184 @@ static void spi_em32_xfer(const struct device *dev)
 		SSP_READ_REG(SSP_DR(cfg->reg));
 	}
 
-	while (data->rx_count < chunk_len || data->tx_count < chunk_len) {
-		/* Fill up fifo with available TX data */
-		while (SSP_TX_FIFO_NOT_FULL(cfg->reg) && data->tx_count < chunk_len &&
-		       fifo_cnt < SSP_FIFO_DEPTH) {
-			/* Send 0 in the case of read only operation */
-			txrx = 0;
+	pl022_fifo_xfer(cfg->reg, data->ctx.tx_buf, data->ctx.rx_buf, chunk_len,
+			spi_em32_frame_fmt(data));
 
-			if (txbuf) {
-				txrx = ((uint8_t *)txbuf)[data->tx_count];
-			}
-			SSP_WRITE_REG(SSP_DR(cfg->reg), txrx);
-			data->tx_count++;
-			fifo_cnt++;
-		}
-		while (data->rx_count < chunk_len && fifo_cnt > 0) {
-			if (!SSP_RX_FIFO_NOT_EMPTY(cfg->reg)) {
-				continue;
-			}
+	data->tx_count = chunk_len;
+	data->rx_count = chunk_len;
+}
+
+#endif
+
+#if defined(CONFIG_SPI_RTIO)
 
-			txrx = SSP_READ_REG(SSP_DR(cfg->reg));
+static void spi_em32_iodev_start(const struct device *dev);
+
+/* Configure for the transaction at the head of the queue and assert CS */
+static void spi_em32_iodev_begin(const struct device *dev)
+{
+	struct spi_em32_data *data = dev->data;
+	struct spi_rtio *rtio_ctx = data->rtio_ctx;
+	struct spi_dt_spec *spi_dt_spec = rtio_ctx->txn_head->sqe.iodev->data;
+	int ret;
 
-			/* Discard received data if rx buffer not assigned */
-			if (rxbuf) {
-				((uint8_t *)rxbuf)[data->rx_count] = (uint8_t)txrx;
+	if (SPI_OP_MODE_GET(spi_dt_spec->config.operation) != SPI_OP_MODE_MASTER) {
+		spi_em32_iodev_complete(dev, -ENOTSUP);
+		return;
+	}
+
+#if defined(CONFIG_SPI_EM32_TARGET)
+	if (data->target.active) {
+		spi_em32_iodev_complete(dev, -EBUSY);
+		return;
+	}
+#endif
+
+	ret = spi_em32_configure(dev, &spi_dt_spec->config);
+	if (ret < 0) {
+		spi_em32_iodev_complete(dev, ret);
+		return;
+	}
+
+	spi_context_cs_control(&data->ctx, true);
+	spi_em32_iodev_start(dev);
+}
+
+/*
+ * Called from the ISR or DMA completion when one SQE has been clocked out.
+ * The next SQE of the same transaction starts immediately with CS held;
+ * otherwise the transaction is completed and the next queued one begins,
+ * so a chain never waits for a thread.
+ *
+ * An SQE that finishes synchronously calls back in here from
+ * spi_em32_iodev_start(). That nested call only records the status and the
+ * outer loop moves on, so a chain of short SQEs does not grow the stack.
+ */
+static void spi_em32_iodev_complete(const struct device *dev, int status)
+{
+	struct spi_em32_data *data = dev->data;
+	struct spi_rtio *rtio_ctx = data->rtio_ctx;
+	k_spinlock_key_t key = k_spin_lock(&data->rtio_lock);
+
+	data->rtio_status = status;
+	data->rtio_done = true;
+	if (data->rtio_running) {
+		k_spin_unlock(&data->rtio_lock, key);
+		return;
+	}
+	data->rtio_running = true;
+
+	while (data->rtio_done) {
+		data->rtio_done = false;
+		status = data->rtio_status;
+		k_spin_unlock(&data->rtio_lock, key);
+
+		if (status == 0 && (rtio_ctx->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION)) {
+			rtio_ctx->txn_curr = rtio_txn_next(rtio_ctx->txn_curr);
+			spi_em32_iodev_start(dev);
+		} else {
+			spi_context_cs_control(&data->ctx, false);
+			if (spi_rtio_complete(rtio_ctx, status)) {
+				spi_em32_iodev_begin(dev);
 			}
-			data->rx_count++;
-			fifo_cnt--;
 		}
+
+		key = k_spin_lock(&data->rtio_lock);
 	}
+
+	data->rtio_running = false;
+	k_spin_unlock(&data->rtio_lock, key);
 }
 
+static void spi_em32_iodev_start(const struct device *dev)
+{
+	struct spi_em32_data *data = dev->data;
+	struct rtio_sqe *sqe = &data->rtio_ctx->txn_curr->sqe;
+	struct spi_buf *tx_buf = &data->rtio_tx_buf;
+	struct spi_buf *rx_buf = &data->rtio_rx_buf;
+	const struct spi_buf_set *tx_set = &data->rtio_tx_set;
+	const struct spi_buf_set *rx_set = &data->rtio_rx_set;
+	size_t len;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		rx_buf->buf = sqe->rx.buf;
+		rx_buf->len = sqe->rx.buf_len;
+		tx_set = NULL;
+		break;
+	case RTIO_OP_TX:
+		tx_buf->buf = (void *)sqe->tx.buf;
+		tx_buf->len = sqe->tx.buf_len;
+		rx_set = NULL;
+		break;
+	case RTIO_OP_TINY_TX:
+		tx_buf->buf = (void *)sqe->tiny_tx.buf;
+		tx_buf->len = sqe->tiny_tx.buf_len;
+		rx_set = NULL;
+		break;
+	case RTIO_OP_TXRX:
+		tx_buf->buf = (void *)sqe->txrx.tx_buf;
+		tx_buf->len = sqe->txrx.buf_len;
+		rx_buf->buf = sqe->txrx.rx_buf;
+		rx_buf->len = sqe->txrx.buf_len;
+		break;
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		spi_em32_iodev_complete(dev, -EINVAL);
+		return;
+	}
+
+	if (spi_em32_tiny_len(data, tx_set, rx_set, &len)) {
+		spi_em32_xfer_tiny(dev, tx_set, rx_set, len);
+		spi_em32_iodev_complete(dev, 0);
+		return;
+	}
+
+	spi_em32_setup_frames(dev, tx_set, rx_set);
+	spi_context_buffers_setup(&data->ctx, tx_set, rx_set, data->dfs);
+
+	if (!spi_em32_transfer_ongoing(data)) {
+		spi_em32_iodev_complete(dev, 0);
+		return;
+	}
+
+#if defined(CONFIG_SPI_EM32_DMA)
+	const struct spi_em32_cfg *cfg = dev->config;
+
+	if (cfg->dma_enabled) {
+		int ret = spi_em32_start_dma_transceive(dev);
+
+		if (ret != 0) {
+			spi_em32_iodev_complete(dev, MIN(ret, 0));
+		}
+		return;
+	}
 #endif
 
+#if defined(CONFIG_SPI_EM32_INTERRUPT)
+	spi_em32_start_async_xfer(dev);
+#else
+	do {
+		spi_em32_xfer(dev);
+		spi_context_update_tx(&data->ctx, data->dfs, data->tx_count);
+		spi_context_update_rx(&data->ctx, data->dfs, data->rx_count);
+	} while (spi_em32_transfer_ongoing(data));
+
+	spi_em32_iodev_complete(dev, 0);
+#endif
+}
+
+static void spi_em32_iodev_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_em32_data *data = dev->data;
+
+	if (spi_rtio_submit(data->rtio_ctx, iodev_sqe)) {
+		spi_em32_iodev_begin(dev);
+	}
+}
+
+#else /* !CONFIG_SPI_RTIO */
+
 static int spi_em32_transceive_impl(const struct device *dev,
 				     const struct spi_config *config,
 				     const struct spi_buf_set *tx_bufs,
@@ -805,8 +1120,14 @@ static int spi_em32_transceive_impl(const struct device *dev,
 	const struct spi_em32_cfg *cfg = dev->config;
 	struct spi_em32_data *data = dev->data;
 	struct spi_context *ctx = &data->ctx;
+	size_t len;
 	int ret;
 
+	if (SPI_OP_MODE_GET(config->operation) != SPI_OP_MODE_MASTER) {
+		LOG_ERR("Use spi_em32_target_start() for peripheral mode");
+		return -ENOTSUP;
+	}
+
 	spi_context_lock(&data->ctx, (cb ? true : false), cb, userdata, config);
 
 	ret = spi_em32_configure(dev, config);
@@ -814,7 +1135,15 @@ static int spi_em32_transceive_impl(const struct device *dev,
 		goto error;
 	}
 
-	spi_context_buffers_setup(ctx, tx_bufs, rx_bufs, 1);
+	if (cb == NULL && spi_em32_tiny_len(data, tx_bufs, rx_bufs, &len)) {
+		spi_context_cs_control(ctx, true);
+		spi_em32_xfer_tiny(dev, tx_bufs, rx_bufs, len);
+		spi_context_cs_control(ctx, false);
+		goto error;
+	}
+
+	spi_em32_setup_frames(dev, tx_bufs, rx_bufs);
+	spi_context_buffers_setup(ctx, tx_bufs, rx_bufs, data->dfs);
 
 	spi_context_cs_control(ctx, true);
 
@@ -829,8 +1158,6 @@ static int spi_em32_transceive_impl(const struct device *dev,
 				dma_get_status(cfg->dma[i].dev,
 					       cfg->dma[i].channel, &stat);
 			}
-
-			data->dma[i].count = 0;
 		}
 
 		ret = spi_em32_start_dma_transceive(dev);
@@ -838,6 +1165,10 @@ static int spi_em32_transceive_impl(const struct device *dev,
 			spi_context_cs_control(ctx, false);
 			goto error;
 		}
+		if (ret > 0) {
+			/* Empty buffer set */
+			spi_context_complete(ctx, dev, 0);
+		}
 		ret = spi_context_wait_for_completion(ctx);
 #endif
 	} else
@@ -850,8 +1181,8 @@ static int spi_em32_transceive_impl(const struct device *dev,
 	{
 		do {
 			spi_em32_xfer(dev);
-			spi_context_update_tx(ctx, 1, data->tx_count);
-			spi_context_update_rx(ctx, 1, data->rx_count);
+			spi_context_update_tx(ctx, data->dfs, data->tx_count);
+			spi_context_update_rx(ctx, data->dfs, data->rx_count);
 		} while (spi_em32_transfer_ongoing(data));
 
 #if defined(CONFIG_SPI_ASYNC)
@@ -868,6 +1199,498 @@ error:
 	return ret;
 }
 
+#endif /* CONFIG_SPI_RTIO */
+
+#if defined(CONFIG_SPI_EM32_TARGET)
+
+#define TARGET_RING_SIZE CONFIG_SPI_EM32_TARGET_RING_SIZE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(TARGET_RING_SIZE), "Target ring size must be a power of two");
+
+/* Bounded wait for the RX channel to drain the last frames after a CS edge */
+#define TARGET_RX_DRAIN_SPINS 64
+
+/*
+ * Absolute write position of the RX ring: completed passes plus the items
+ * of the active one. A pass whose block interrupt is still pending shows
+ * up as the position going backwards and is accounted for here.
+ */
+static uint32_t spi_em32_target_head(const struct device *dev)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_target *t = &((struct spi_em32_data *)dev->data)->target;
+	struct dma_status stat;
+	uint32_t wraps;
+	uint32_t head;
+
+	/*
+	 * The wrap count comes from the BLOCK callback of the cyclic RX block.
+	 * Sample it on both sides of the DMA status so a wrap counted in
+	 * between cannot pair an old count with a new position.
+	 */
+	do {
+		wraps = t->wraps;
+		if (dma_get_status(cfg->dma[RX].dev, cfg->dma[RX].channel, &stat) < 0 ||
+		    !stat.busy) {
+			return t->last_head;
+		}
+	} while (wraps != t->wraps);
+
+	head = wraps * TARGET_RING_SIZE + (TARGET_RING_SIZE - stat.pending_length);
+	/* The ring wrapped but its BLOCK interrupt has not been taken yet */
+	if ((int32_t)(head - t->last_head) < 0) {
+		head += TARGET_RING_SIZE;
+	}
+	t->last_head = head;
+
+	return head;
+}
+
+static void spi_em32_target_check_overrun(struct spi_em32_target *t)
+{
+	if (t->last_head - t->tail > TARGET_RING_SIZE) {
+		t->tail = t->last_head - TARGET_RING_SIZE;
+		t->overrun = true;
+	}
+}
+
+static void spi_em32_target_dma_callback(const struct device *dma_dev, void *arg,
+					 uint32_t channel, int status)
+{
+	const struct device *dev = (const struct device *)arg;
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	struct spi_em32_target *t = &data->target;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(dma_dev);
+
+	if (status < 0) {
+		LOG_ERR("Target DMA error %d on channel %u", status, channel);
+		return;
+	}
+
+	if (channel != cfg->dma[RX].channel || status != DMA_STATUS_BLOCK) {
+		return;
+	}
+
+	key = k_spin_lock(&data->lock);
+	t->wraps++;
+	(void)spi_em32_target_head(dev);
+	spi_em32_target_check_overrun(t);
+	k_spin_unlock(&data->lock, key);
+}
+
+static int spi_em32_target_start_rx(const struct device *dev)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	struct dma_config *dma_cfg = &data->dma[RX].config;
+	struct dma_block_config *blk = &data->dma[RX].block[0];
+	int ret;
+
+	memset(dma_cfg, 0, sizeof(*dma_cfg));
+	memset(blk, 0, sizeof(*blk));
+
+	/* One cyclic block over the whole ring keeps the position readable */
+	blk->source_address = SSP_DR(cfg->reg);
+	blk->dest_address = (uint32_t)data->target.ring;
+	blk->block_size = TARGET_RING_SIZE;
+	blk->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+	blk->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+
+	dma_cfg->channel_direction = PERIPHERAL_TO_MEMORY;
+	dma_cfg->dma_slot = cfg->dma[RX].slot;
+	dma_cfg->source_data_size = 1;
+	dma_cfg->dest_data_size = 1;
+	/* Single transfers, so no partial burst sits in the channel at a CS edge */
+	dma_cfg->source_burst_length = 1;
+	dma_cfg->dest_burst_length = 1;
+	dma_cfg->block_count = 1;
+	dma_cfg->head_block = blk;
+	dma_cfg->cyclic = 1;
+	dma_cfg->dma_callback = spi_em32_target_dma_callback;
+	dma_cfg->user_data = (void *)dev;
+
+	ret = dma_config(cfg->dma[RX].dev, cfg->dma[RX].channel, dma_cfg);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return dma_start(cfg->dma[RX].dev, cfg->dma[RX].channel);
+}
+
+/* Load the pending response into the TX channel; the FIFO fills right away */
+static int spi_em32_target_arm_tx(const struct device *dev)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	struct spi_em32_target *t = &data->target;
+	struct dma_config *dma_cfg = &data->dma[TX].config;
+	const uint8_t *buf = t->resp;
+	size_t remaining = t->resp_len;
+	uint32_t count = 0;
+
+	(void)dma_stop(cfg->dma[TX].dev, cfg->dma[TX].channel);
+
+	t->resp = NULL;
+	t->resp_len = 0;
+
+	if (buf == NULL || remaining == 0U) {
+		return 0;
+	}
+
+	memset(dma_cfg, 0, sizeof(*dma_cfg));
+
+	while (remaining > 0U) {
+		struct dma_block_config *blk = &data->dma[TX].block[count];
+		size_t len = MIN(remaining, SPI_EM32_DMA_MAX_FRAMES);
+
+		memset(blk, 0, sizeof(*blk));
+		blk->source_address = (uint32_t)buf;
+		blk->dest_address = SSP_DR(cfg->reg);
+		blk->block_size = len;
+		blk->source_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		blk->dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		if (count > 0U) {
+			data->dma[TX].block[count - 1U].next_block = blk;
+		}
+
+		buf += len;
+		remaining -= len;
+		count++;
+	}
+
+	dma_cfg->channel_direction = MEMORY_TO_PERIPHERAL;
+	dma_cfg->dma_slot = cfg->dma[TX].slot;
+	dma_cfg->source_data_size = 1;
+	dma_cfg->dest_data_size = 1;
+	dma_cfg->source_burst_length = SSP_DMA_BURST_FRAMES;
+	dma_cfg->dest_burst_length = SSP_DMA_BURST_FRAMES;
+	dma_cfg->block_count = count;
+	dma_cfg->head_block = data->dma[TX].block;
+	dma_cfg->dma_callback = spi_em32_target_dma_callback;
+	dma_cfg->user_data = (void *)dev;
+
+	if (dma_config(cfg->dma[TX].dev, cfg->dma[TX].channel, dma_cfg) < 0) {
+		return -EIO;
+	}
+
+	return dma_start(cfg->dma[TX].dev, cfg->dma[TX].channel);
+}
+
+/*
+ * A host that clocks fewer bytes than armed leaves the rest of the response
+ * in the TX FIFO. The PL022 has no FIFO flush, so the controller is reset
+ * and reprogrammed when the node has a reset line.
+ */
+static void spi_em32_target_flush_tx(const struct device *dev)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+
+	if (SSP_TX_FIFO_EMPTY(cfg->reg)) {
+		return;
+	}
+
+#if defined(CONFIG_RESET)
+	if (cfg->reset.dev) {
+		const struct spi_config *spicfg = data->ctx.config;
+
+		(void)reset_line_toggle_dt(&cfg->reset);
+		data->ctx.config = NULL;
+		data->cur_valid = false;
+		(void)spi_em32_configure(dev, spicfg);
+		SSP_WRITE_REG(SSP_DMACR(cfg->reg), SSP_DMACR_MASK_RXDMAE | SSP_DMACR_MASK_TXDMAE);
+		return;
+	}
+#endif
+
+	LOG_WRN("Frame ended with unsent response bytes in the TX FIFO");
+}
+
+/*
+ * Runs on the system work queue after chip-select was deasserted: waits
+ * for the RX channel to drain the last frames, reports the frame and arms
+ * the next response before the SSP is enabled again. A frame the host
+ * starts before this has run is not clocked.
+ */
+static void spi_em32_target_frame_work(struct k_work *work)
+{
+	struct spi_em32_target *t = CONTAINER_OF(work, struct spi_em32_target, frame_work);
+	const struct device *dev = t->dev;
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t spins = TARGET_RX_DRAIN_SPINS;
+	size_t len;
+	int status;
+
+	while (SSP_RX_FIFO_NOT_EMPTY(cfg->reg) && --spins > 0U) {
+	}
+
+	key = k_spin_lock(&data->lock);
+
+	if (!t->active || !t->frame_pending) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	/* Frames still in the RX FIFO at the edge belong to the frame too */
+	len = t->frame_len + (spi_em32_target_head(dev) - t->frame_end);
+	spi_em32_target_check_overrun(t);
+	status = t->overrun ? -ENOBUFS : 0;
+	t->overrun = false;
+
+	k_spin_unlock(&data->lock, key);
+
+	/* frame_pending keeps set_response() off the TX channel meanwhile */
+	(void)dma_stop(cfg->dma[TX].dev, cfg->dma[TX].channel);
+	spi_em32_target_flush_tx(dev);
+
+	key = k_spin_lock(&data->lock);
+	if (spi_em32_target_arm_tx(dev) < 0) {
+		LOG_ERR("Failed to arm target response");
+	}
+	t->frame_pending = false;
+	SSP_WRITE_REG(SSP_CR1(cfg->reg), SSP_READ_REG(SSP_CR1(cfg->reg)) | SSP_CR1_MASK_SSE);
+	k_spin_unlock(&data->lock, key);
+
+	if (t->cb != NULL) {
+		t->cb(dev, len, status, t->user_data);
+	}
+}
+
+static void spi_em32_target_cs_handler(const struct device *port, struct gpio_callback *cb,
+				       gpio_port_pins_t pins)
+{
+	struct spi_em32_target *t = CONTAINER_OF(cb, struct spi_em32_target, cs_cb);
+	const struct device *dev = t->dev;
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(port);
+	ARG_UNUSED(pins);
+
+	key = k_spin_lock(&data->lock);
+
+	if (gpio_pin_get_dt(&cfg->target_cs) > 0) {
+		/* Asserted: the frame starts at the current ring position */
+		t->frame_start = spi_em32_target_head(dev);
+		t->in_frame = true;
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	if (!t->in_frame) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	/*
+	 * Stop the SSP so no stale response bytes are shifted out, and leave
+	 * the RX drain and the TX re-arm to the work item.
+	 */
+	SSP_CLEAR_REG(SSP_CR1(cfg->reg), SSP_CR1_MASK_SSE);
+	t->in_frame = false;
+	t->frame_pending = true;
+	t->frame_end = spi_em32_target_head(dev);
+	t->frame_len = t->frame_end - t->frame_start;
+
+	k_spin_unlock(&data->lock, key);
+
+	k_work_submit(&t->frame_work);
+}
+
+int spi_em32_target_start(const struct device *dev, const struct spi_config *config,
+			  spi_em32_target_cb_t cb, void *user_data)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	struct spi_em32_target *t = &data->target;
+	int ret;
+
+	if (!cfg->dma_enabled || cfg->target_cs.port == NULL) {
+		LOG_ERR("Peripheral mode needs DMA and target-cs-gpios");
+		return -ENOTSUP;
+	}
+
+	if (SPI_OP_MODE_GET(config->operation) != SPI_OP_MODE_SLAVE ||
+	    SPI_WORD_SIZE_GET(config->operation) != 8) {
+		return -EINVAL;
+	}
+
+	if (t->active) {
+		return -EALREADY;
+	}
+
+	spi_context_lock(&data->ctx, false, NULL, NULL, config);
+
+	ret = spi_em32_configure(dev, config);
+	if (ret < 0) {
+		goto error;
+	}
+
+	data->dfs = 1;
+	data->packed = false;
+	if (IS_ENABLED(CONFIG_SPI_EM32_PACK_16BIT_DMA)) {
+		spi_em32_set_swap(cfg, false);
+	}
+
+	t->dev = dev;
+	t->cb = cb;
+	t->user_data = user_data;
+	t->wraps = 0;
+	t->last_head = 0;
+	t->tail = 0;
+	t->frame_start = 0;
+	t->frame_end = 0;
+	t->frame_len = 0;
+	t->in_frame = false;
+	t->frame_pending = false;
+	t->overrun = false;
+	t->resp = NULL;
+	t->resp_len = 0;
+	k_work_init(&t->frame_work, spi_em32_target_frame_work);
+
+	ret = spi_em32_target_start_rx(dev);
+	if (ret < 0) {
+		LOG_ERR("Failed to start target RX DMA %d", ret);
+		goto error;
+	}
+
+	ret = spi_em32_target_arm_tx(dev);
+	if (ret < 0) {
+		goto error_dma;
+	}
+
+	SSP_WRITE_REG(SSP_DMACR(cfg->reg), SSP_DMACR_MASK_RXDMAE | SSP_DMACR_MASK_TXDMAE);
+
+	ret = gpio_pin_configure_dt(&cfg->target_cs, GPIO_INPUT);
+	if (ret < 0) {
+		goto error_dma;
+	}
+
+	gpio_init_callback(&t->cs_cb, spi_em32_target_cs_handler, BIT(cfg->target_cs.pin));
+	ret = gpio_add_callback(cfg->target_cs.port, &t->cs_cb);
+	if (ret < 0) {
+		goto error_dma;
+	}
+
+	t->active = true;
+
+	ret = gpio_pin_interrupt_configure_dt(&cfg->target_cs, GPIO_INT_EDGE_BOTH);
+	if (ret < 0) {
+		t->active = false;
+		(void)gpio_remove_callback(cfg->target_cs.port, &t->cs_cb);
+		goto error_dma;
+	}
+
+	return 0;
+
+error_dma:
+	SSP_CLEAR_REG(SSP_DMACR(cfg->reg), SSP_DMACR_MASK_RXDMAE | SSP_DMACR_MASK_TXDMAE);
+	for (size_t i = 0; i < ARRAY_SIZE(cfg->dma); i++) {
+		(void)dma_stop(cfg->dma[i].dev, cfg->dma[i].channel);
+	}
+error:
+	data->ctx.config = NULL;
+	spi_context_unlock_unconditionally(&data->ctx);
+	return ret;
+}
+
+int spi_em32_target_set_response(const struct device *dev, const uint8_t *buf, size_t len)
+{
+	struct spi_em32_data *data = dev->data;
+	struct spi_em32_target *t = &data->target;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (len > (size_t)data->dma_max_blocks * SPI_EM32_DMA_MAX_FRAMES) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->lock);
+
+	if (!t->active) {
+		ret = -EIO;
+		goto out;
+	}
+
+	t->resp = buf;
+	t->resp_len = len;
+
+	/* Mid-frame the response is picked up once the frame has been handled */
+	if (!t->in_frame && !t->frame_pending) {
+		ret = spi_em32_target_arm_tx(dev);
+	}
+
+out:
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+int spi_em32_target_read(const struct device *dev, uint8_t *buf, size_t len)
+{
+	struct spi_em32_data *data = dev->data;
+	struct spi_em32_target *t = &data->target;
+	k_spinlock_key_t key;
+	uint32_t offset;
+	size_t first;
+
+	key = k_spin_lock(&data->lock);
+
+	if (!t->active) {
+		k_spin_unlock(&data->lock, key);
+		return -EIO;
+	}
+
+	(void)spi_em32_target_head(dev);
+	spi_em32_target_check_overrun(t);
+	len = MIN(len, t->last_head - t->tail);
+	offset = t->tail & (TARGET_RING_SIZE - 1U);
+	t->tail += len;
+
+	k_spin_unlock(&data->lock, key);
+
+	first = MIN(len, TARGET_RING_SIZE - offset);
+	memcpy(buf, &t->ring[offset], first);
+	memcpy(buf + first, t->ring, len - first);
+
+	return len;
+}
+
+int spi_em32_target_stop(const struct device *dev)
+{
+	const struct spi_em32_cfg *cfg = dev->config;
+	struct spi_em32_data *data = dev->data;
+	struct spi_em32_target *t = &data->target;
+
+	if (!t->active) {
+		return -EALREADY;
+	}
+
+	(void)gpio_pin_interrupt_configure_dt(&cfg->target_cs, GPIO_INT_DISABLE);
+	(void)gpio_remove_callback(cfg->target_cs.port, &t->cs_cb);
+	t->active = false;
+	(void)k_work_cancel(&t->frame_work);
+
+	SSP_CLEAR_REG(SSP_DMACR(cfg->reg), SSP_DMACR_MASK_RXDMAE | SSP_DMACR_MASK_TXDMAE);
+	for (size_t i = 0; i < ARRAY_SIZE(cfg->dma); i++) {
+		(void)dma_stop(cfg->dma[i].dev, cfg->dma[i].channel);
+	}
+
+	/* Force the next controller transfer to reprogram CR1 */
+	data->ctx.config = NULL;
+	spi_context_unlock_unconditionally(&data->ctx);
+
+	return 0;
+}
+
+#endif /* CONFIG_SPI_EM32_TARGET */
+
 /* API Functions */
 
 static int spi_em32_transceive(const struct device *dev,
@@ -875,10 +1698,17 @@ static int spi_em32_transceive(const struct device *dev,
 				const struct spi_buf_set *tx_bufs,
 				const struct spi_buf_set *rx_bufs)
 {
+#if defined(CONFIG_SPI_RTIO)
+	struct spi_em32_data *data = dev->data;
+
+	/* Blocking calls share the RTIO queue so they serialize with chains */
+	return spi_rtio_transceive(data->rtio_ctx, config, tx_bufs, rx_bufs);
+#else
 	return spi_em32_transceive_impl(dev, config, tx_bufs, rx_bufs, NULL, NULL);
+#endif
 }
 
-#if defined(CONFIG_SPI_ASYNC)
+#if defined(CONFIG_SPI_ASYNC) && !defined(CONFIG_SPI_RTIO)
 
 static int spi_em32_transceive_async(const struct device *dev,
 				      const struct spi_config *config,
@@ -904,11 +1734,11 @@ static int spi_em32_release(const struct device *dev,
 
 static DEVICE_API(spi, spi_em32_api) = {
 	.transceive = spi_em32_transceive,
-#if defined(CONFIG_SPI_ASYNC)
+#if defined(CONFIG_SPI_ASYNC) && !defined(CONFIG_SPI_RTIO)
 	.transceive_async = spi_em32_transceive_async,
 #endif
 #ifdef CONFIG_SPI_RTIO
-	.iodev_submit = spi_rtio_iodev_default_submit,
+	.iodev_submit = spi_em32_iodev_submit,
 #endif
 	.release = spi_em32_release
 };
@@ -968,6 +1798,16 @@ static int spi_em32_init(const struct device *dev)
 				return ret;
 			}
 		}
+
+		data->dma_max_blocks = CONFIG_SPI_EM32_DMA_MAX_BLOCKS;
+		for (size_t i = 0; i < spi_em32_dma_enabled_num(dev); i++) {
+			uint32_t max_blocks;
+
+			if (dma_get_attribute(cfg->dma[i].dev, DMA_ATTR_MAX_BLOCK_COUNT,
+					      &max_blocks) == 0) {
+				data->dma_max_blocks = MIN(data->dma_max_blocks, max_blocks);
+			}
+		}
 #endif
 	} else {
 #if defined(CONFIG_SPI_EM32_INTERRUPT)
@@ -987,6 +1827,14 @@ static int spi_em32_init(const struct device *dev)
 		return ret;
 	}
 
+#if defined(CONFIG_SPI_RTIO)
+	spi_rtio_init(data->rtio_ctx, dev);
+	data->rtio_tx_set.buffers = &data->rtio_tx_buf;
+	data->rtio_tx_set.count = 1;
+	data->rtio_rx_set.buffers = &data->rtio_rx_buf;
+	data->rtio_rx_set.count = 1;
+#endif
+
 	/* Make sure the context is unlocked */
 	spi_context_unlock_unconditionally(&data->ctx);
 
@@ -998,7 +1846,6 @@ static int spi_em32_init(const struct device *dev)
 		.dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(idx, dir)),                         \
 		.channel = DT_INST_DMAS_CELL_BY_NAME(idx, dir, channel),                           \
 		.slot = DT_INST_DMAS_CELL_BY_NAME(idx, dir, slot),                                 \
-		.channel_config = DT_INST_DMAS_CELL_BY_NAME(idx, dir, channel_config),             \
 	}
 
 #define DMAS_DECL(idx)                                                                             \
@@ -1019,18 +1866,19 @@ static int spi_em32_init(const struct device *dev)
 	IF_ENABLED(CONFIG_SPI_EM32_INTERRUPT,                                                     \
 		   (static void spi_em32_irq_config_##idx(const struct device *dev)               \
 		    {                                                                              \
-			   LOG_INF("Configuring SPI IRQ %d with priority %d",                      \
-				   DT_INST_IRQN(idx), DT_INST_IRQ(idx, priority));                 \
 			   IRQ_CONNECT(DT_INST_IRQN(idx), DT_INST_IRQ(idx, priority),              \
 				       spi_em32_isr, DEVICE_DT_INST_GET(idx), 0);                 \
 			   irq_enable(DT_INST_IRQN(idx));                                          \
-			   LOG_INF("SPI IRQ %d enabled", DT_INST_IRQN(idx));                       \
 		    }))                                                                            \
 	IF_ENABLED(CONFIG_CLOCK_CONTROL, (CLOCK_ID_DECL(idx)))                                     \
+	IF_ENABLED(CONFIG_SPI_RTIO, (SPI_RTIO_DEFINE(spi_em32_rtio_##idx,                        \
+						     CONFIG_SPI_EM32_RTIO_SQ_SIZE,                 \
+						     CONFIG_SPI_EM32_RTIO_CQ_SIZE);))              \
 	static struct spi_em32_data spi_em32_data_##idx = {                                      \
 		SPI_CONTEXT_INIT_LOCK(spi_em32_data_##idx, ctx),                                  \
 		SPI_CONTEXT_INIT_SYNC(spi_em32_data_##idx, ctx),                                  \
-		SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(idx), ctx)};                           \
+		SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(idx), ctx)                             \
+		IF_ENABLED(CONFIG_SPI_RTIO, (.rtio_ctx = &spi_em32_rtio_##idx,))};                 \
 	static struct spi_em32_cfg spi_em32_cfg_##idx = {                                        \
 		.reg = DT_INST_REG_ADDR(idx),                                                      \
 		IF_ENABLED(CONFIG_CLOCK_CONTROL, (IF_ENABLED(DT_INST_NODE_HAS_PROP(idx, clocks),     \
@@ -1043,7 +1891,9 @@ static int spi_em32_init(const struct device *dev)
 				CONFIG_SPI_EM32_DMA, (.dma_enabled = DMAS_ENABLED(idx),),         \
 				(.dma_enabled = false,))                                           \
 		IF_ENABLED(CONFIG_SPI_EM32_INTERRUPT,                                             \
-					   (.irq_config = spi_em32_irq_config_##idx,))};          \
+					   (.irq_config = spi_em32_irq_config_##idx,))            \
+		IF_ENABLED(CONFIG_SPI_EM32_TARGET,                                                \
+			   (.target_cs = GPIO_DT_SPEC_INST_GET_OR(idx, target_cs_gpios, {0}),))};  \
 	SPI_DEVICE_DT_INST_DEFINE(idx, spi_em32_init, NULL, &spi_em32_data_##idx,                \
 			      &spi_em32_cfg_##idx, POST_KERNEL, CONFIG_SPI_INIT_PRIORITY,         \
 			      &spi_em32_api);
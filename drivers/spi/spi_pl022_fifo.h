@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * PL022 FIFO transfer core shared by the EM32 SSP drivers.
+ *
+ * At most PL022_FIFO_DEPTH frames are kept in flight, so the RX FIFO can
+ * never overrun and the TX FIFO never needs a "not full" check. A set
+ * RXRIS bit guarantees half a FIFO of received frames, which are then
+ * moved without further status reads. Only the last few frames of a
+ * transfer are collected one SR read at a time.
+ */
+
+#ifndef ZEPHYR_DRIVERS_SPI_SPI_PL022_FIFO_H_
+#define ZEPHYR_DRIVERS_SPI_SPI_PL022_FIFO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/toolchain.h>
+
+#define PL022_FIFO_DR(base)  ((base) + 0x008)
+#define PL022_FIFO_SR(base)  ((base) + 0x00C)
+#define PL022_FIFO_IMSC(base) ((base) + 0x014)
+#define PL022_FIFO_RIS(base) ((base) + 0x018)
+#define PL022_FIFO_ICR(base) ((base) + 0x020)
+
+#define PL022_FIFO_SR_RNE    BIT(2)
+#define PL022_FIFO_SR_BSY    BIT(4)
+#define PL022_FIFO_RIS_RXRIS BIT(2)
+#define PL022_FIFO_ICR_RORIC BIT(0)
+#define PL022_FIFO_ICR_RTIC  BIT(1)
+
+#define PL022_FIFO_DEPTH 8
+#define PL022_FIFO_HALF  (PL022_FIFO_DEPTH / 2)
+
+#define PL022_FIFO_READ(reg)       (*((volatile uint32_t *)(reg)))
+#define PL022_FIFO_WRITE(reg, val) (*((volatile uint32_t *)(reg)) = (val))
+
+/* In-memory layout of one frame */
+enum pl022_frame {
+	/* 4 to 8 bit frames, one byte each */
+	PL022_FRAME_8,
+	/* 9 to 16 bit frames, one native uint16_t each */
+	PL022_FRAME_16,
+	/* Byte pairs clocked as one 16-bit frame, first byte on the wire first */
+	PL022_FRAME_16_BE,
+};
+
+static ALWAYS_INLINE uint32_t pl022_frame_get(const void *buf, size_t idx, enum pl022_frame fmt)
+{
+	switch (fmt) {
+	case PL022_FRAME_8:
+		return ((const uint8_t *)buf)[idx];
+	case PL022_FRAME_16_BE:
+		return sys_get_be16((const uint8_t *)buf + 2 * idx);
+	default:
+		return ((const uint16_t *)buf)[idx];
+	}
+}
+
+static ALWAYS_INLINE void pl022_frame_put(void *buf, size_t idx, uint32_t val,
+					  enum pl022_frame fmt)
+{
+	switch (fmt) {
+	case PL022_FRAME_8:
+		((uint8_t *)buf)[idx] = (uint8_t)val;
+		break;
+	case PL022_FRAME_16_BE:
+		sys_put_be16((uint16_t)val, (uint8_t *)buf + 2 * idx);
+		break;
+	default:
+		((uint16_t *)buf)[idx] = (uint16_t)val;
+		break;
+	}
+}
+
+/*
+ * Move as many frames as the FIFOs allow without waiting. A NULL @p tx
+ * clocks zeros and a NULL @p rx discards; both are resolved at compile
+ * time in the variants below.
+ */
+static ALWAYS_INLINE void pl022_fifo_step_impl(uintptr_t base, const void *tx, void *rx,
+					       uint32_t len, uint32_t *tx_count,
+					       uint32_t *rx_count, enum pl022_frame fmt)
+{
+	uint32_t txc = *tx_count;
+	uint32_t rxc = *rx_count;
+	uint32_t n;
+
+	while (rxc < txc) {
+		if (PL022_FIFO_READ(PL022_FIFO_RIS(base)) & PL022_FIFO_RIS_RXRIS) {
+			n = PL022_FIFO_HALF;
+		} else if (PL022_FIFO_READ(PL022_FIFO_SR(base)) & PL022_FIFO_SR_RNE) {
+			n = 1;
+		} else {
+			break;
+		}
+
+		for (; n > 0U; n--, rxc++) {
+			uint32_t val = PL022_FIFO_READ(PL022_FIFO_DR(base));
+
+			if (rx != NULL) {
+				pl022_frame_put(rx, rxc, val, fmt);
+			}
+		}
+	}
+
+	n = MIN(len - txc, PL022_FIFO_DEPTH - (txc - rxc));
+	for (; n > 0U; n--, txc++) {
+		PL022_FIFO_WRITE(PL022_FIFO_DR(base),
+				 tx != NULL ? pl022_frame_get(tx, txc, fmt) : 0U);
+	}
+
+	*tx_count = txc;
+	*rx_count = rxc;
+}
+
+static inline void pl022_fifo_step_tx(uintptr_t base, const void *tx, uint32_t len,
+				      uint32_t *tx_count, uint32_t *rx_count,
+				      enum pl022_frame fmt)
+{
+	pl022_fifo_step_impl(base, tx, NULL, len, tx_count, rx_count, fmt);
+}
+
+static inline void pl022_fifo_step_rx(uintptr_t base, void *rx, uint32_t len,
+				      uint32_t *tx_count, uint32_t *rx_count,
+				      enum pl022_frame fmt)
+{
+	pl022_fifo_step_impl(base, NULL, rx, len, tx_count, rx_count, fmt);
+}
+
+static inline void pl022_fifo_step_txrx(uintptr_t base, const void *tx, void *rx, uint32_t len,
+					uint32_t *tx_count, uint32_t *rx_count,
+					enum pl022_frame fmt)
+{
+	pl022_fifo_step_impl(base, tx, rx, len, tx_count, rx_count, fmt);
+}
+
+/**
+ * @brief Advance a transfer of @p len frames as far as the FIFOs allow.
+ *
+ * Used from FIFO interrupts. The transfer is finished once
+ * *@p rx_count reaches @p len.
+ */
+static inline void pl022_fifo_step(uintptr_t base, const void *tx, void *rx, uint32_t len,
+				   uint32_t *tx_count, uint32_t *rx_count, enum pl022_frame fmt)
+{
+	if (tx == NULL) {
+		pl022_fifo_step_rx(base, rx, len, tx_count, rx_count, fmt);
+	} else if (rx == NULL) {
+		pl022_fifo_step_tx(base, tx, len, tx_count, rx_count, fmt);
+	} else {
+		pl022_fifo_step_txrx(base, tx, rx, len, tx_count, rx_count, fmt);
+	}
+}
+
+/**
+ * @brief Clock @p len frames by polling, returning once all were received.
+ */
+static inline void pl022_fifo_xfer(uintptr_t base, const void *tx, void *rx, uint32_t len,
+				   enum pl022_frame fmt)
+{
+	uint32_t tx_count = 0;
+	uint32_t rx_count = 0;
+
+	if (tx == NULL) {
+		while (rx_count < len) {
+			pl022_fifo_step_rx(base, rx, len, &tx_count, &rx_count, fmt);
+		}
+	} else if (rx == NULL) {
+		while (rx_count < len) {
+			pl022_fifo_step_tx(base, tx, len, &tx_count, &rx_count, fmt);
+		}
+	} else {
+		while (rx_count < len) {
+			pl022_fifo_step_txrx(base, tx, rx, len, &tx_count, &rx_count, fmt);
+		}
+	}
+}
+
+/**
+ * @brief Check whether a transfer fits a single FIFO.
+ *
+ * Stores the transfer length in bytes in *@p len. Transfers of at most
+ * one FIFO of 8-bit frames may bypass the context engine through
+ * pl022_fifo_xfer_tiny().
+ */
+static inline bool pl022_fifo_tiny_len(const struct spi_buf_set *tx_bufs,
+				       const struct spi_buf_set *rx_bufs, size_t *len)
+{
+	size_t tx_len = 0;
+	size_t rx_len = 0;
+
+	for (size_t i = 0; tx_bufs != NULL && i < tx_bufs->count; i++) {
+		tx_len += tx_bufs->buffers[i].len;
+	}
+	for (size_t i = 0; rx_bufs != NULL && i < rx_bufs->count; i++) {
+		rx_len += rx_bufs->buffers[i].len;
+	}
+
+	*len = MAX(tx_len, rx_len);
+
+	return *len > 0U && *len <= PL022_FIFO_DEPTH;
+}
+
+/**
+ * @brief Clock a tiny transfer of 8-bit frames in one burst.
+ *
+ * The whole TX side goes into the FIFO back to back and, as it cannot
+ * overflow the RX FIFO, the answer is collected after a single wait for
+ * the controller to go idle. FIFO interrupts are masked meanwhile. The
+ * caller must have programmed CR0 for 8-bit frames.
+ */
+static inline void pl022_fifo_xfer_tiny(uintptr_t base, const struct spi_buf_set *tx_bufs,
+					const struct spi_buf_set *rx_bufs, size_t len)
+{
+	const uint32_t imsc = PL022_FIFO_READ(PL022_FIFO_IMSC(base));
+	uint8_t frames[PL022_FIFO_DEPTH] = {0};
+	size_t n = 0;
+
+	PL022_FIFO_WRITE(PL022_FIFO_IMSC(base), 0);
+
+	for (size_t i = 0; tx_bufs != NULL && i < tx_bufs->count; i++) {
+		const struct spi_buf *buf = &tx_bufs->buffers[i];
+
+		if (buf->buf != NULL) {
+			memcpy(&frames[n], buf->buf, buf->len);
+		}
+		n += buf->len;
+	}
+
+	while (PL022_FIFO_READ(PL022_FIFO_SR(base)) & PL022_FIFO_SR_RNE) {
+		PL022_FIFO_READ(PL022_FIFO_DR(base));
+	}
+
+	for (n = 0; n < len; n++) {
+		PL022_FIFO_WRITE(PL022_FIFO_DR(base), frames[n]);
+	}
+
+	while (PL022_FIFO_READ(PL022_FIFO_SR(base)) & PL022_FIFO_SR_BSY) {
+	}
+
+	for (n = 0; n < len; n++) {
+		frames[n] = PL022_FIFO_READ(PL022_FIFO_DR(base));
+	}
+
+	PL022_FIFO_WRITE(PL022_FIFO_ICR(base), PL022_FIFO_ICR_RORIC | PL022_FIFO_ICR_RTIC);
+	PL022_FIFO_WRITE(PL022_FIFO_IMSC(base), imsc);
+
+	n = 0;
+	for (size_t i = 0; rx_bufs != NULL && i < rx_bufs->count; i++) {
+		const struct spi_buf *buf = &rx_bufs->buffers[i];
+
+		if (buf->buf != NULL) {
+			memcpy(buf->buf, &frames[n], buf->len);
+		}
+		n += buf->len;
+	}
+}
+
+#endif /* ZEPHYR_DRIVERS_SPI_SPI_PL022_FIFO_H_ */
@@ -13,6 +13,8 @@
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/usb/udc.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/usb/usb_ch9.h>
 #include "udc_e967.h"
 
 #define __GLOBAL_DEBUG_LOG__ 0
@@ -28,31 +30,47 @@ LOG_MODULE_REGISTER(udc_e967, CONFIG_UDC_DRIVER_LOG_LEVEL);
 
 #define _IS_SET_CLEAR_FEATURE_PATCH	1
 
-enum UDC_E967_MSG_TYPE {
-	UDC_E967_MSG_TYPE_SETUP,
-	UDC_E967_MSG_TYPE_XFER,
-	UDC_E967_MSG_TYPE_SW_RECONN,
-};
+/*
+ * Work for the handler thread, one bit per kind. A transfer event sets the
+ * endpoint's bit, OUT endpoints in [4:0] and IN endpoints in [20:16], so
+ * repeated events for one endpoint merge. SETUP has a single slot: the ISR
+ * keeps only the latest packet in setup_pkg and the thread handles that.
+ */
+#define E967_EVT_XFER_IN_SHIFT 16
+#define E967_EVT_SUSPEND       BIT(30)
+#define E967_EVT_SETUP         BIT(31)
+
+/*
+ * USB PLL relock when leaving suspend: pwr_work polls it every millisecond
+ * and power cycles the PLL when it has not locked within the timeout
+ */
+#define E967_PLL_LOCK_TIMEOUT_MS 2
+#define E967_PLL_RELOCK_TRIES    3
+/* Remote wakeup K-state duration, USB 2.0 7.1.7.7 allows 1 to 15 ms */
+#define E967_RESUME_SIGNAL_MS    10
 
-struct udc_e967_msg {
-	enum UDC_E967_MSG_TYPE type;
-	union {
-		struct {
-			enum udc_event_type type;
-		} udc_bus_event;
-		struct {
-			uint32_t ref;
-		} setup;
-		struct {
-			uint8_t ep;
-		} out;
-		struct {
-			uint8_t ep;
-		} in;
-		struct {
-			uint8_t ep;
-		} xfer;
-	};
+/* OUT endpoint descriptors remapped to EP3 that the offset cache can hold */
+#define E967_REMAP_MAX    4
+#define E967_REMAP_OUT_EP (USB_EP_DIR_OUT | 3)
+
+/* Status flags as read from the whole UDCEP0INTSTA / UDCEPxINTSTA words */
+#define E967_EP0_STA_IN  BIT(1)
+#define E967_EP0_STA_OUT BIT(2)
+#define E967_EPX_STA_IN  BIT(0)
+#define E967_EPX_STA_OUT BIT(1)
+
+/*
+ * USB clock bring-up. Each state waits for one oscillator or the PLL to
+ * settle; clk_work polls and advances it, so nothing busy-waits and the
+ * rest of boot runs while the clocks come up.
+ */
+enum e967_clk_state {
+	E967_CLK_OFF,
+	E967_CLK_XTAL_WAIT,   /* XTAL powered, waiting for XTALSTABLE */
+	E967_CLK_XTAL_SETTLE, /* XTAL stable, extra settling time */
+	E967_CLK_LJIRC_WAIT,  /* LJIRC powered */
+	E967_CLK_PLL_WAIT,    /* USB PLL powered, waiting for lock */
+	E967_CLK_READY,
 };
 
 struct udc_e967_config {
@@ -81,8 +99,23 @@ struct udc_e967_data {
 	uint8_t setup_pkg[8];
 	const struct device *dev;
 	uint8_t addr;
-	struct k_msgq *msgq;
+	atomic_t evt_pending;
+	struct k_sem evt_sem;
 	struct k_thread thread_data;
+	struct k_work_delayable clk_work;
+	enum e967_clk_state clk_state;
+	/* Controller setup and connect wait for E967_CLK_READY */
+	bool hw_init_pending;
+	bool connect_pending;
+	/* UDC clock gated, USB PLL and PHY powered down for bus suspend */
+	bool pwr_down;
+	/* Leaving pwr_down, pwr_work waits for the PLL to lock */
+	bool pwr_relock;
+	/* Remote wakeup signaling waits for the relock */
+	bool pwr_wakeup;
+	uint32_t pwr_polls;
+	struct k_work_delayable pwr_work;
+	struct k_work_delayable wakeup_work;
 	uint8_t ep_out_num;
 	uint8_t ep_out_num_new;
 	
@@ -97,8 +130,18 @@ struct udc_e967_data {
 	uint32_t is_addressed_state;
 	uint32_t is_configured_state;
 	uint32_t is_proc_remote_wakeup;
+	/* OUT data stage filled by the EP0 OUT ISR, submitted with its SETUP when full */
+	struct net_buf *ep0_out_pkt;
+	struct net_buf *ep0_out_data;
+	uint32_t ep0_out_len;
+	/* Offsets of the remapped bEndpointAddress bytes in the configuration descriptor */
+	uint16_t remap_off[E967_REMAP_MAX];
+	uint8_t remap_cnt;
+	bool remap_valid;
 	volatile uint32_t *reg_ep0_data_buf;
 	struct e967_usbd_ep epx_ctrl[USB_NUM_BIDIR_ENDPOINTS - 1];
+	/* Buffer RAM per EP1..EP4 in bytes, from the fifo-depths property */
+	uint16_t fifo_depth[USB_NUM_BIDIR_ENDPOINTS - 1];
 
 	EP_BUF_STA *reg_ep_buf_sta;
 
@@ -164,6 +207,42 @@ static struct e967_usbd_ep *_e967_get_ep(struct udc_e967_data *priv, uint8_t ep_
 	return &priv->epx_ctrl[ep_idx - 1];
 }
 
+/*
+ * The endpoint data ports move one byte per access and have no DMA
+ * request line, so a packet costs one bus access per byte. Unroll the
+ * copy four bytes per iteration so the loop overhead is not paid on
+ * every byte as well.
+ */
+static inline void _e967_fifo_read(volatile uint32_t *port, uint8_t *dst, uint32_t len)
+{
+	for (; len >= 4; len -= 4) {
+		dst[0] = (uint8_t)*port;
+		dst[1] = (uint8_t)*port;
+		dst[2] = (uint8_t)*port;
+		dst[3] = (uint8_t)*port;
+		dst += 4;
+	}
+
+	while (len--) {
+		*dst++ = (uint8_t)*port;
+	}
+}
+
+static inline void _e967_fifo_write(volatile uint32_t *port, const uint8_t *src, uint32_t len)
+{
+	for (; len >= 4; len -= 4) {
+		*port = src[0];
+		*port = src[1];
+		*port = src[2];
+		*port = src[3];
+		src += 4;
+	}
+
+	while (len--) {
+		*port = *src++;
+	}
+}
+
 static inline void _e967_usbd_sw_disconnect(const struct device *dev)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
@@ -176,13 +255,14 @@ static inline void _e967_usbd_sw_connect(const struct device *dev)
 	priv->reg_usb_phy->USBPHYRSW = 1;
 }
 
-static void _e967_usb_clock_set(struct udc_e967_data *priv, uint8_t Usb_Clk_Sel)
+/*
+ * Power up the USB clock source and return the time in ms to wait before
+ * the first _e967_usb_clock_step().
+ */
+static uint32_t _e967_usb_clock_start(struct udc_e967_data *priv, uint8_t Usb_Clk_Sel)
 {
-	volatile uint32_t reg;
 	uint32_t _trim_Code;
 
-	(void)_trim_Code;
-
 	CLKGatingDisable(PCLKG_AIP);
 
 	if ((Usb_Clk_Sel == USB_XTAL_12M) || (Usb_Clk_Sel == USB_XTAL_24M)) {
@@ -201,54 +281,95 @@ static void _e967_usb_clock_set(struct udc_e967_data *priv, uint8_t Usb_Clk_Sel)
 		// Xtal Power on
 		priv->reg_xtal_ctrl->XTALPD = 0;
 
-		k_busy_wait(2000);
-		do {
-			reg = priv->reg_xtal_ctrl->XTALSTABLE;
-		} while (reg == 0);
-		k_busy_wait(12000);
-	} else if (Usb_Clk_Sel == USB_IRC) {
-		// Load LJIRC Trim Code : Info 0x100A6090
-		_trim_Code = *((uint32_t *)0x100A6090);
-		priv->reg_ljirc_ctrl->LJIRCFR = _trim_Code & 0x0000000F;
-		priv->reg_ljirc_ctrl->LJIRCCA = (_trim_Code & 0x000001F0) >> 4;
-		priv->reg_ljirc_ctrl->LJIRCFC = (_trim_Code & 0x00000E00) >> 9;
-		priv->reg_ljirc_ctrl->LJIRCTMV10 = (_trim_Code & 0x00003000) >> 12;
-
-		// Load PHY R Trim Code : Info 0x100A60F0
-		_trim_Code = *((uint32_t *)0x100A60F0);
-		priv->reg_usb_phy->PHYRTRIM = _trim_Code;
-
-		// xtal_ljirc_sel  Select : 0 = XTAL, 1= LJIRC
-		priv->reg_sysreg->XTALLJIRCSEL = 1;
+		priv->clk_state = E967_CLK_XTAL_WAIT;
+		return 2;
 	}
 
-	// LJIRC power down
+	// Load LJIRC Trim Code : Info 0x100A6090
+	_trim_Code = *((uint32_t *)0x100A6090);
+	priv->reg_ljirc_ctrl->LJIRCFR = _trim_Code & 0x0000000F;
+	priv->reg_ljirc_ctrl->LJIRCCA = (_trim_Code & 0x000001F0) >> 4;
+	priv->reg_ljirc_ctrl->LJIRCFC = (_trim_Code & 0x00000E00) >> 9;
+	priv->reg_ljirc_ctrl->LJIRCTMV10 = (_trim_Code & 0x00003000) >> 12;
+
+	// Load PHY R Trim Code : Info 0x100A60F0
+	_trim_Code = *((uint32_t *)0x100A60F0);
+	priv->reg_usb_phy->PHYRTRIM = _trim_Code;
+
+	// xtal_ljirc_sel  Select : 0 = XTAL, 1= LJIRC
+	priv->reg_sysreg->XTALLJIRCSEL = 1;
+
+	// LJIRC power on
 	priv->reg_ljirc_ctrl->LJIRCPD = 0;
 
-	k_busy_wait(2000);
+	priv->clk_state = E967_CLK_LJIRC_WAIT;
+	return 2;
+}
 
-	// USB Clock Select
-	priv->reg_sysreg->USBCLKSEL = 0;
+/* Advance the bring-up; returns the time in ms to the next step, 0 when done */
+static uint32_t _e967_usb_clock_step(struct udc_e967_data *priv)
+{
+	switch (priv->clk_state) {
+	case E967_CLK_XTAL_WAIT:
+		if (priv->reg_xtal_ctrl->XTALSTABLE == 0) {
+			return 1;
+		}
+		priv->clk_state = E967_CLK_XTAL_SETTLE;
+		return 12;
+
+	case E967_CLK_XTAL_SETTLE:
+		// LJIRC power on
+		priv->reg_ljirc_ctrl->LJIRCPD = 0;
+		priv->clk_state = E967_CLK_LJIRC_WAIT;
+		return 2;
+
+	case E967_CLK_LJIRC_WAIT:
+		// USB Clock Select
+		priv->reg_sysreg->USBCLKSEL = 0;
+
+		// UDC Clock Enable
+		CLKGatingDisable(PCLKG_UDC);
+
+		// USB PLL PD Disable
+		priv->reg_usbpll_ctrl->USBPLLPD = 0;
+		priv->clk_state = E967_CLK_PLL_WAIT;
+		__fallthrough;
+
+	case E967_CLK_PLL_WAIT:
+		if (priv->reg_usbpll_ctrl->USBPLLSTABLE == 0) {
+			return 1;
+		}
 
-	// UDC Clock Enable
-	CLKGatingDisable(PCLKG_UDC);
+		// USB PHY PD Disable
+		priv->reg_usb_phy->USBPHYPDB = 1;
+		priv->clk_state = E967_CLK_READY;
+		return 0;
 
-	// USB PLL PD Disable
-	priv->reg_usbpll_ctrl->USBPLLPD = 0;
+	default:
+		return 0;
+	}
+}
 
-	// Wait PLL Stable
-	while (priv->reg_usbpll_ctrl->USBPLLSTABLE == 0)
-		;
+/*
+ * Bus suspend: power down the PHY and the USB PLL and gate the UDC clock.
+ * The USBWAKEUPEN detector set in _e967_usb_init() raises the resume or
+ * reset interrupt, whose handler calls _e967_usb_power_up() first.
+ * Call with interrupts locked.
+ */
+static void _e967_usb_power_down(struct udc_e967_data *priv)
+{
+	if (!IS_ENABLED(CONFIG_UDC_E967_SUSPEND_POWER_DOWN) || priv->pwr_down ||
+	    priv->clk_state != E967_CLK_READY) {
+		return;
+	}
 
-	// USB PHY PD Disable
-	priv->reg_usb_phy->USBPHYPDB = 1;
+	priv->reg_usb_phy->USBPHYPDB = 0;
+	priv->reg_usbpll_ctrl->USBPLLPD = 1;
+	CLKGatingEnable(PCLKG_UDC);
+	priv->pwr_down = true;
 }
 
 static const unsigned char _ep_conf_data[6] = {0x43, 0x43, 0x42, 0x42, 0xFA, 0x00};
-static const uint32_t ep1_size = 64;
-static const uint32_t ep2_size = 64;
-static const uint32_t ep3_size = 64;
-static const uint32_t ep4_size = 64;
 
 void _ep_internal_setup(struct udc_e967_data *priv)
 {
@@ -264,8 +385,8 @@ void _ep_internal_setup(struct udc_e967_data *priv)
 		;
 
 	// Endpoint FIFO Depth Setting
-	E967_EPBUFDEPTH0 = (ep2_size << 16) + ep1_size;
-	E967_EPBUFDEPTH1 = (ep4_size << 16) + ep3_size;
+	E967_EPBUFDEPTH0 = ((uint32_t)priv->fifo_depth[1] << 16) | priv->fifo_depth[0];
+	E967_EPBUFDEPTH1 = ((uint32_t)priv->fifo_depth[3] << 16) | priv->fifo_depth[2];
 }
 
 void _e967_phy_setup(struct udc_e967_data *priv)
@@ -358,57 +479,88 @@ void _e967_epx_init(const struct device *dev)
 	return;
 }
 
-static int _udc_e967_send_msg(const struct device *dev, const struct udc_e967_msg *msg)
+/* Post work to the handler thread; callable from ISRs, never fails */
+static void _udc_e967_post_evt(const struct device *dev, uint32_t evt)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
-	int err;
 
-	err = k_msgq_put(priv->msgq, msg, K_NO_WAIT);
-	if (err < 0) {
-		k_msgq_purge(priv->msgq);
-	}
+	atomic_or(&priv->evt_pending, evt);
+	k_sem_give(&priv->evt_sem);
+}
 
-	return err;
+static inline uint32_t _udc_e967_xfer_evt(uint8_t ep)
+{
+	return BIT(USB_EP_GET_IDX(ep) + (USB_EP_DIR_IS_IN(ep) ? E967_EVT_XFER_IN_SHIFT : 0));
 }
 
+/*
+ * OUT endpoints are moved to EP3 by rewriting their bEndpointAddress in the
+ * configuration descriptor on its way to the host. The offsets are taken
+ * from whatever part of the descriptor a read returns, and cached for good
+ * once a read covered all of it; later reads only patch the cached offsets.
+ * Other control IN data is never looked at. Which endpoint EP3 serves is
+ * set when the stack enables it, see udc_e967_ep_enable_api().
+ */
 void _get_out_pipe_num( const struct device *dev, struct net_buf *buf)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
 	uint8_t *ptr;
-	uint8_t *pEnd;
 	uint32_t len;
-	
+	uint32_t i;
+
+	if (priv->setup_pkg[0] != (USB_REQTYPE_DIR_TO_HOST << 7) ||
+	    priv->setup_pkg[1] != USB_SREQ_GET_DESCRIPTOR ||
+	    priv->setup_pkg[3] != USB_DESC_CONFIGURATION) {
+		return;
+	}
+
 	ptr = buf->data;
 	len = buf->len;
-	
-	if( len <= 9)
+
+	if( len <= 9 || ptr[0] != 0x09 || ptr[1] != 0x02)
 		return;
-	
-	if( ptr[0] == 0x09 && ptr[1] == 0x02) {
-		pEnd = ptr+len;
-		ptr = ptr + ptr[0];
-		while( ptr < pEnd )
-		{
-			if( ptr[0] == 7 && ptr[1] == 5) {
-				if( (ptr[2] & 0x80) == 0)
-				{
-					priv->ep_out_num = ptr[2];
-					priv->ep_out_num_new = 3;
-					ptr[2] = priv->ep_out_num_new;
-				}
+
+	if (!priv->remap_valid) {
+		priv->remap_cnt = 0;
+		for (i = ptr[0]; i + 2 < len && ptr[i] != 0; i += ptr[i]) {
+			if (ptr[i] == 7 && ptr[i + 1] == 5 && (ptr[i + 2] & 0x80) == 0 &&
+			    priv->remap_cnt < E967_REMAP_MAX) {
+				priv->remap_off[priv->remap_cnt++] = i + 2;
 			}
-			ptr = ptr + ptr[0];
+		}
+		priv->remap_valid = len >= sys_get_le16(&ptr[2]);
+	}
+
+	for (i = 0; i < priv->remap_cnt; i++) {
+		if (priv->remap_off[i] < len) {
+			ptr[priv->remap_off[i]] = E967_REMAP_OUT_EP;
 		}
 	}
 }
 
+/*
+ * Max packet size of a hardware endpoint. The remap target is enabled by
+ * _enable_all_ep() and never through the stack, so its own cfg has no MPS:
+ * that of the endpoint the class enabled applies. EP_MPS is the fallback.
+ */
+static uint16_t _e967_ep_mps(const struct device *dev, struct udc_ep_config *ep_cfg)
+{
+	struct udc_e967_data *priv = udc_get_private(dev);
+	uint16_t mps = udc_mps_ep_size(ep_cfg);
+
+	if (mps == 0 && priv->ep_out_num != 0 && ep_cfg->addr == priv->ep_out_num_new) {
+		mps = udc_mps_ep_size(udc_get_ep_cfg(dev, priv->ep_out_num));
+	}
+
+	return mps != 0 ? mps : EP_MPS;
+}
+
 static int udc_e967_ep_enqueue(const struct device *dev, struct udc_ep_config *const cfg,
 			       struct net_buf *buf)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
 	struct udc_ep_config *new_cfg;
 	unsigned int lock_key;
-	struct udc_e967_msg msg = {0};
 	uint32_t isHalt;
 	uint8_t ep = cfg->addr;
 
@@ -432,14 +584,29 @@ static int udc_e967_ep_enqueue(const struct device *dev, struct udc_ep_config *c
 	isHalt = cfg->stat.halted;
 	irq_unlock(lock_key);
 
-	if (!isHalt) {
-		msg.type = UDC_E967_MSG_TYPE_XFER;
-		msg.xfer.ep = ep;
-		_udc_e967_send_msg(dev, &msg);
-	} else {
+	if (isHalt) {
 #if (__GLOBAL_DEBUG_LOG__ > 0)
 		printk("[INFO] ep:0x%2x is halted, enqueue buf=%p fail\n", ep, buf);
 #endif
+	} else if (USB_EP_GET_IDX(ep) != 0) {
+		/*
+		 * Packets of a running transfer are chained from the endpoint ISR.
+		 * A new buffer only has to restart an endpoint that ran dry, and
+		 * that is done here rather than through the handler thread.
+		 * While suspended the buffer waits for e967_usb_resume_isr().
+		 */
+		if (priv->pwr_down) {
+			/* Restarted by _e967_usb_restart_queued() */
+		} else if (USB_EP_DIR_IS_OUT(ep)) {
+			_e967_usbd_xfer_out(dev, ep);
+		} else {
+			_e967_usbd_xfer_in(dev, ep);
+		}
+	} else if (ep == USB_CONTROL_EP_IN) {
+		/* Re-arm EP0 IN now; the ISR streams the data stage from the buffer */
+		_usbd_ctrl_in(dev, ep);
+	} else {
+		_udc_e967_post_evt(dev, _udc_e967_xfer_evt(ep));
 	}
 
 	return 0;
@@ -518,33 +685,192 @@ static int udc_e967_ep_clear_halt(const struct device *dev, struct udc_ep_config
 	return 0;
 }
 
+/* Kick endpoints that had buffers queued while powered down */
+static void _e967_usb_restart_queued(const struct device *dev)
+{
+	for (uint8_t i = 1; i < USB_NUM_BIDIR_ENDPOINTS; i++) {
+		if (udc_buf_peek(udc_get_ep_cfg(dev, USB_EP_DIR_OUT | i)) != NULL) {
+			_udc_e967_post_evt(dev, _udc_e967_xfer_evt(USB_EP_DIR_OUT | i));
+		}
+		if (udc_buf_peek(udc_get_ep_cfg(dev, USB_EP_DIR_IN | i)) != NULL) {
+			_udc_e967_post_evt(dev, _udc_e967_xfer_evt(USB_EP_DIR_IN | i));
+		}
+	}
+}
+
+static void udc_e967_wakeup_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct udc_e967_data *priv = CONTAINER_OF(dwork, struct udc_e967_data, wakeup_work);
+
+	priv->reg_udc_ctrl1->UDC_CTRL1_.UDCCTRL1BIT.DEVRESUME = 0;
+}
+
+/* Drive resume signaling; udc_e967_wakeup_work_handler() ends it */
+static void _e967_usb_resume_signal(struct udc_e967_data *priv)
+{
+	priv->reg_udc_ctrl1->UDC_CTRL1_.UDCCTRL1BIT.DEVRESUME = 1;
+	k_work_reschedule(&priv->wakeup_work, K_MSEC(E967_RESUME_SIGNAL_MS));
+}
+
+/* Finish leaving pwr_down once the PLL has locked; call with IRQs locked */
+static bool _e967_usb_power_up_done(const struct device *dev)
+{
+	struct udc_e967_data *priv = udc_get_private(dev);
+
+	if (priv->reg_usbpll_ctrl->USBPLLSTABLE == 0) {
+		return false;
+	}
+
+	priv->reg_usb_phy->USBPHYPDB = 1;
+	priv->pwr_down = false;
+	priv->pwr_relock = false;
+	_e967_usb_restart_queued(dev);
+
+	if (priv->pwr_wakeup) {
+		priv->pwr_wakeup = false;
+		_e967_usb_resume_signal(priv);
+	}
+
+	return true;
+}
+
+/*
+ * Undo _e967_usb_power_down() without waiting for the PLL: the UDC clock
+ * is ungated at once, so the status registers are readable on return, and
+ * pwr_work completes the power-up if the PLL has not locked yet. Call with
+ * IRQs locked; safe from ISRs.
+ */
+static void _e967_usb_power_up(const struct device *dev)
+{
+	struct udc_e967_data *priv = udc_get_private(dev);
+
+	if (!priv->pwr_down || priv->pwr_relock) {
+		return;
+	}
+
+	CLKGatingDisable(PCLKG_UDC);
+	priv->reg_usbpll_ctrl->USBPLLPD = 0;
+
+	if (!_e967_usb_power_up_done(dev)) {
+		priv->pwr_relock = true;
+		priv->pwr_polls = 0;
+		k_work_reschedule(&priv->pwr_work, K_MSEC(1));
+	}
+}
+
+static void udc_e967_pwr_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct udc_e967_data *priv = CONTAINER_OF(dwork, struct udc_e967_data, pwr_work);
+	const struct device *dev = priv->dev;
+	unsigned int key;
+
+	key = irq_lock();
+
+	if (!priv->pwr_relock || _e967_usb_power_up_done(dev)) {
+		irq_unlock(key);
+		return;
+	}
+
+	if (++priv->pwr_polls < E967_PLL_LOCK_TIMEOUT_MS * E967_PLL_RELOCK_TRIES) {
+		if (priv->pwr_polls % E967_PLL_LOCK_TIMEOUT_MS == 0) {
+			LOG_WRN("USB PLL did not relock, power cycling it");
+			priv->reg_usbpll_ctrl->USBPLLPD = 1;
+			priv->reg_usbpll_ctrl->USBPLLPD = 0;
+		}
+		k_work_reschedule(dwork, K_MSEC(1));
+		irq_unlock(key);
+		return;
+	}
+
+	/* Left powered down; the next resume or reset interrupt tries again */
+	priv->reg_usbpll_ctrl->USBPLLPD = 1;
+	CLKGatingEnable(PCLKG_UDC);
+	priv->pwr_relock = false;
+	priv->pwr_wakeup = false;
+	irq_unlock(key);
+
+	LOG_ERR("USB PLL did not relock");
+	udc_submit_event(dev, UDC_EVT_ERROR, -ETIMEDOUT);
+}
+
 static int udc_e967_host_wakeup(const struct device *dev)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
-	
-	priv->reg_udc_ctrl1->UDC_CTRL1_.UDCCTRL1BIT.DEVRESUME = 1;
-	
-	k_busy_wait( 10000);
-	
-	priv->reg_udc_ctrl1->UDC_CTRL1_.UDCCTRL1BIT.DEVRESUME = 0;
-	
+	unsigned int key;
+
+	key = irq_lock();
+	_e967_usb_power_up(dev);
+	if (priv->pwr_down) {
+		/* Signaled by _e967_usb_power_up_done() once the PLL has locked */
+		priv->pwr_wakeup = true;
+		irq_unlock(key);
+		return 0;
+	}
+	irq_unlock(key);
+
+	_e967_usb_resume_signal(priv);
+
 	return 0;
 }
 
+/* Drop an OUT data stage superseded by a new SETUP or a bus reset; call with IRQs locked */
+static void _e967_ep0_out_drop(struct udc_e967_data *priv)
+{
+	if (priv->ep0_out_pkt != NULL) {
+		net_buf_unref(priv->ep0_out_pkt);
+		priv->ep0_out_pkt = NULL;
+		priv->ep0_out_data = NULL;
+	}
+}
+
+/* Move one EP0 OUT packet into the armed data stage; call with IRQs locked */
+static void _e967_ep0_out_read(const struct device *dev)
+{
+	struct udc_e967_data *priv = udc_get_private(dev);
+	struct net_buf *data_buf = priv->ep0_out_data;
+	struct net_buf *pkt;
+	uint32_t len;
+
+	if (priv->reg_ep0_int_sts->UDC_EP0_INTSTA.UDC_EP0_INT_STABIT.EP0OUTINTSF == 0) {
+		return;
+	}
+	priv->reg_ep0_int_sts->UDC_EP0_INTSTA.UDC_EP0_INT_STABIT.EP0OUTINTSFCLR = 1;
+	priv->ep0_out_size = 0;
+
+	len = MIN(EP0_MPS, priv->ep0_out_len - data_buf->len);
+	_e967_fifo_read(priv->reg_ep0_data_buf, net_buf_tail(data_buf), len);
+	net_buf_add(data_buf, len);
+
+	if (data_buf->len == priv->ep0_out_len) {
+#if ( __EP0_LOG__ > 1)
+		printk("[INFO] ep0-out read %i bytes\n", data_buf->len);
+#endif
+		pkt = priv->ep0_out_pkt;
+		priv->ep0_out_pkt = NULL;
+		priv->ep0_out_data = NULL;
+		udc_submit_ep_event(dev, pkt, 0);
+	}
+}
+
+/*
+ * Arm the OUT data stage. The packets are read by the EP0 OUT ISR, and the
+ * SETUP buffer with the data attached goes to the stack from there once the
+ * last one is in, so a multi-packet stage costs no thread wake-ups.
+ */
 static int usbd_ctrl_feed_dout(const struct device *dev, struct net_buf *pSetupPkg)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
-	//	struct udc_ep_config *cfg = udc_get_ep_cfg(dev, USB_CONTROL_EP_OUT);
 	struct udc_buf_info *bi;
 	struct net_buf *data_buf;
 	struct net_buf *st_buf;
-	uint8_t *data_ptr;
-	uint32_t data_len;
-	uint32_t len, i, bRead;
+	unsigned int lock_key;
 	uint32_t length = udc_data_stage_length(pSetupPkg);
 
 	data_buf = udc_ctrl_alloc(dev, USB_CONTROL_EP_OUT, length);
 	if (data_buf == NULL) {
+		net_buf_unref(pSetupPkg);
 		return -ENOMEM;
 	}
 
@@ -553,54 +879,33 @@ static int usbd_ctrl_feed_dout(const struct device *dev, struct net_buf *pSetupP
 	bi->data = true;
 
 	st_buf = udc_ctrl_alloc(dev, USB_CONTROL_EP_IN, 0);
-	if (data_buf == NULL) {
+	if (st_buf == NULL) {
+		net_buf_unref(pSetupPkg);
 		return -ENOMEM;
 	}
 	net_buf_frag_add(data_buf, st_buf);
 	bi = udc_get_buf_info(st_buf);
 	bi->status = true;
 
-	bRead = 0;
-	do {
-		if (priv->ep0_proc_ref != priv->ep0_cur_ref) {
-			goto _error;
-		}
-
-		data_ptr = net_buf_tail(data_buf);
-		data_len = net_buf_tailroom(data_buf);
-		if (data_len == 0) {
-			break;
-		}
-		if (priv->reg_ep0_int_sts->UDC_EP0_INTSTA.UDC_EP0_INT_STABIT.EP0OUTINTSF) {
-			priv->reg_ep0_int_sts->UDC_EP0_INTSTA.UDC_EP0_INT_STABIT.EP0OUTINTSFCLR = 1;
-			priv->ep0_out_size = 0;
+	lock_key = irq_lock();
 
-			len = EP0_MPS;
-			if (len > data_len) {
-				len = data_len;
-			}
+	/* A newer SETUP replaced this one; it is handled on its own, no error */
+	if (priv->ep0_proc_ref != priv->ep0_cur_ref) {
+		irq_unlock(lock_key);
+		net_buf_unref(pSetupPkg);
+		return 0;
+	}
 
-			for (i = 0; i < len; i++) {
-				*data_ptr = *(priv->reg_ep0_data_buf);
-			}
-			net_buf_add(data_buf, len);
-			bRead = bRead + len;
-		}
-	} while (1);
+	priv->ep0_out_pkt = pSetupPkg;
+	priv->ep0_out_data = data_buf;
+	priv->ep0_out_len = length;
 
-#if ( __EP0_LOG__ > 1)
-	printk("[INFO] ep0-out read %i bytes\n", bRead);
-#endif
+	/* The first packet may have arrived before the stage was armed */
+	_e967_ep0_out_read(dev);
 
-	udc_submit_ep_event(dev, pSetupPkg, 0);
+	irq_unlock(lock_key);
 
 	return 0;
-
-_error:
-	net_buf_unref(pSetupPkg);
-	net_buf_unref(data_buf);
-	net_buf_unref(st_buf);
-	return -1;
 }
 
 void _update_address_event(const struct device *dev)
@@ -705,7 +1010,6 @@ void _update_configured_event( const struct device *dev)
 int _handle_set_feature_remote_wakeup( const struct device *dev, uint32_t isSet)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
-	struct udc_e967_msg msg;
 	//struct net_buf *pSetupPkg;
 	//uint8_t *data_ptr;
 	
@@ -733,10 +1037,7 @@ int _handle_set_feature_remote_wakeup( const struct device *dev, uint32_t isSet)
 	
 	priv->ep0_cur_ref++;
 
-	msg.type = UDC_E967_MSG_TYPE_SETUP;
-	msg.setup.ref = priv->ep0_cur_ref;
-
-	k_msgq_put(priv->msgq, &msg, K_NO_WAIT);
+	_udc_e967_post_evt(dev, E967_EVT_SETUP);
 	
 #if 0	
 	pSetupPkg = udc_ctrl_alloc(dev, USB_CONTROL_EP_OUT, 8);
@@ -771,7 +1072,7 @@ int _handle_set_feature_remote_wakeup( const struct device *dev, uint32_t isSet)
 }
 #endif
 
-static int udc_e967_msg_handler_setup(const struct device *dev, struct udc_e967_msg *msg)
+static int udc_e967_msg_handler_setup(const struct device *dev)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
 	//	struct udc_data *udata = dev->data;
@@ -785,7 +1086,7 @@ static int udc_e967_msg_handler_setup(const struct device *dev, struct udc_e967_
 	//	struct udc_buf_info *bi;
 	int i;
 	int err = 0;
-	//	unsigned int lock_key;
+	unsigned int lock_key;
 	//	uint32_t reg;
 	//	uint32_t isValid;
 	//	uint16_t length;
@@ -799,8 +1100,6 @@ static int udc_e967_msg_handler_setup(const struct device *dev, struct udc_e967_
 
 	pSetupPkg = NULL;
 
-	priv->ep0_proc_ref = msg->setup.ref;
-
 	ep_ctrl_in = udc_get_ep_cfg(dev, USB_CONTROL_EP_IN);
 	ep_ctrl_out = udc_get_ep_cfg(dev, USB_CONTROL_EP_OUT);
 
@@ -812,12 +1111,19 @@ static int udc_e967_msg_handler_setup(const struct device *dev, struct udc_e967_
 
 	// allocate and copy setup pkg
 	pSetupPkg = udc_ctrl_alloc(dev, USB_CONTROL_EP_OUT, 8);
+	if (pSetupPkg == NULL) {
+		return -ENOMEM;
+	}
 	udc_ep_buf_set_setup(pSetupPkg);
 	data_ptr = net_buf_tail(pSetupPkg);
 
+	/* The ISR overwrites setup_pkg when a newer SETUP arrives */
+	lock_key = irq_lock();
 	for (i = 0; i < 8; i++) {
 		*(data_ptr + i) = priv->setup_pkg[i];
 	}
+	priv->ep0_proc_ref = priv->ep0_cur_ref;
+	irq_unlock(lock_key);
 	net_buf_add(pSetupPkg, 8);
 
 #if ( __EP0_LOG__ > 0)	
@@ -828,21 +1134,13 @@ static int udc_e967_msg_handler_setup(const struct device *dev, struct udc_e967_
 	udc_ctrl_update_stage(dev, pSetupPkg);
 
 	if (udc_ctrl_stage_is_data_out(dev)) {
-		usbd_ctrl_feed_dout(dev, pSetupPkg);
-		return 0;
+		err = usbd_ctrl_feed_dout(dev, pSetupPkg);
 	} else if (udc_ctrl_stage_is_data_in(dev)) {
 		err = udc_ctrl_submit_s_in_status(dev);
 	} else {
 		err = udc_ctrl_submit_s_status(dev);
 	}
 
-	return 0;
-}
-
-/* Message handler for S/W reconnect */
-static int _e967_usbd_msg_handle_sw_reconn(const struct device *dev, struct udc_e967_msg *msg)
-{
-	int err = 0;
 	return err;
 }
 
@@ -924,12 +1222,8 @@ static int _epx_check_buffer_empty(struct udc_e967_data *priv, uint8_t ep)
 }
 #endif
 
-static int _e967_usbd_msg_handle_xfer(const struct device *dev, struct udc_e967_msg *msg)
+static int _e967_usbd_msg_handle_xfer(const struct device *dev, uint8_t ep)
 {
-	uint8_t ep;
-
-	ep = msg->xfer.ep;
-
 	if (USB_EP_GET_IDX(ep) == 0) {
 		_usbd_ctrl_handler(dev, ep);
 		return 0;
@@ -947,43 +1241,57 @@ static int _e967_usbd_msg_handle_xfer(const struct device *dev, struct udc_e967_
 static void e967_usbd_msg_handler(const struct device *dev)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
-	struct udc_e967_msg msg;
+	uint32_t pending;
+	uint32_t xfer;
 	int err;
 
 	while (true) {
-		if (k_msgq_get(priv->msgq, &msg, K_FOREVER)) {
-			// if (k_msgq_get(priv->msgq, &msg, K_MSEC(100))) {
+		k_sem_take(&priv->evt_sem, K_FOREVER);
+
+		pending = atomic_clear(&priv->evt_pending);
+		if (pending == 0) {
 			continue;
 		}
 
-		err = 0;
-
 		udc_lock_internal(dev, K_FOREVER);
 
-		switch (msg.type) {
-		case UDC_E967_MSG_TYPE_SETUP:
-			err = udc_e967_msg_handler_setup(dev, &msg);
-			break;
-		case UDC_E967_MSG_TYPE_XFER:
-			err = _e967_usbd_msg_handle_xfer(dev, &msg);
-			break;
-
-		case UDC_E967_MSG_TYPE_SW_RECONN:
-			err = _e967_usbd_msg_handle_sw_reconn(dev, &msg);
-			break;
+		/*
+		 * Transfers queued before a new SETUP belong to the previous
+		 * control transfer, so they are handled first.
+		 */
+		xfer = pending & ~(E967_EVT_SETUP | E967_EVT_SUSPEND);
+		while (xfer != 0) {
+			uint32_t bit = find_lsb_set(xfer) - 1;
+			uint8_t ep = bit >= E967_EVT_XFER_IN_SHIFT
+					     ? USB_EP_DIR_IN | (bit - E967_EVT_XFER_IN_SHIFT)
+					     : USB_EP_DIR_OUT | bit;
+
+			xfer &= ~BIT(bit);
+			err = _e967_usbd_msg_handle_xfer(dev, ep);
+			if (err) {
+				udc_submit_event(dev, UDC_EVT_ERROR, err);
+			}
+		}
 
-		default:
-#if (__GLOBAL_DEBUG_LOG__ > 0)		
-			printk("[DEBUG] unknown msg\n");
-#endif
-			__ASSERT_NO_MSG(false);
+		if (pending & E967_EVT_SETUP) {
+			err = udc_e967_msg_handler_setup(dev);
+			if (err) {
+				udc_submit_event(dev, UDC_EVT_ERROR, err);
+			}
 		}
 
-		udc_unlock_internal(dev);
+		/* Last, so control work queued before the suspend is done first */
+		if (pending & E967_EVT_SUSPEND) {
+			unsigned int key = irq_lock();
 
-		if (err) {
-			udc_submit_event(dev, UDC_EVT_ERROR, err);
+			/* Resume may have arrived in the meantime */
+			if (udc_is_suspended(dev)) {
+				_e967_usb_power_down(priv);
+			}
+			irq_unlock(key);
 		}
+
+		udc_unlock_internal(dev);
 	}
 }
 
@@ -1008,12 +1316,17 @@ static void e967_usb_suspend_isr(const struct device *dev)
 
 	udc_set_suspended(dev, true);
 	udc_submit_event(dev, UDC_EVT_SUSPEND, 0);	
+	_udc_e967_post_evt(dev, E967_EVT_SUSPEND);
 	
 	return;
 }
 static void e967_usb_resume_isr(const struct device *dev)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
+
+	/* Clocks first: the status registers are not readable while gated */
+	_e967_usb_power_up(dev);
+
 	if (priv->reg_udc_int_sta->UDCINT_STA.UDC_INT_STABIT.RESUMEINTSF == 1) {
 		priv->reg_udc_int_sta->UDCINT_STA.UDC_INT_STABIT.RESUMEINTSFCLR = 1;
 	}
@@ -1034,6 +1347,10 @@ static void e967_usb_resume_isr(const struct device *dev)
 static void e967_usb_reset_isr(const struct device *dev)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
+
+	/* A host may reset a suspended device without resuming it first */
+	_e967_usb_power_up(dev);
+
 	if (priv->reg_udc_int_sta->UDCINT_STA.UDC_INT_STABIT.RSTINTSF == 1) {
 		priv->reg_udc_int_sta->UDCINT_STA.UDC_INT_STABIT.RSTINTSFCLR = 1;
 	}
@@ -1049,6 +1366,7 @@ static void e967_usb_reset_isr(const struct device *dev)
 	priv->is_configured_state = 0;	
 	priv->ep_out_num = 0;
 	priv->ep_out_num_new = 0;
+	_e967_ep0_out_drop(priv);
 
 	udc_submit_event( dev, UDC_EVT_RESET, 0);
 	
@@ -1059,11 +1377,8 @@ static void e967_usb_setup_isr(const struct device *dev)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
 	struct udc_ep_config *ep_cfg;
-	struct udc_e967_msg msg;
 	uint8_t *ptr;
 	struct net_buf *buf;
-	uint32_t index;
-	int err;
 	__asm volatile("nop");
 
 	ep_cfg = udc_get_ep_cfg(dev, USB_CONTROL_EP_IN);
@@ -1074,10 +1389,9 @@ static void e967_usb_setup_isr(const struct device *dev)
 
 	priv->ep0_in_size = 0;
 	priv->ep0_out_size = 0;
+	_e967_ep0_out_drop(priv);
 
-	for (index = 0; index < 8; index++) {
-		priv->setup_pkg[index] = (uint8_t)*(priv->reg_ep0_data_buf);
-	}
+	_e967_fifo_read(priv->reg_ep0_data_buf, priv->setup_pkg, sizeof(priv->setup_pkg));
 
 	priv->ep0_cur_ref++;
 
@@ -1087,18 +1401,8 @@ static void e967_usb_setup_isr(const struct device *dev)
 	//printk("\n[INFO][SETUP ISR]: %x %x %x %x %x %x %x %x :%i\n", ptr[0], ptr[1], ptr[2], ptr[3], ptr[4],
 	//       ptr[5], ptr[6], ptr[7], priv->ep0_cur_ref);
 #endif
-	msg.type = UDC_E967_MSG_TYPE_SETUP;
-	msg.setup.ref = priv->ep0_cur_ref;
-
-	err = k_msgq_put(priv->msgq, &msg, K_NO_WAIT);
-	if (err < 0) {
-#if ( __EP0_LOG__ > 0)
-		printk("[SETUP] put msg failed, err=%i\n", err);
-#endif		
-		goto _exit;
-	}
+	_udc_e967_post_evt(dev, E967_EVT_SETUP);
 
-_exit:
 	// Clear Setup Interrupt Flag
 	UDCEP0INTSTA->UDC_EP0_INTSTA.UDC_EP0_INT_STABIT.SETUPINTSFCLR = 1;
 
@@ -1112,10 +1416,12 @@ void _e967_proc_ep0_h2d(const struct device *dev)
 #if ( __EP0_LOG__ > 2)
 	printk("[INFO] EP0-OUT-ISR\n");
 #endif
-	if (priv->ep0_out_size == 1) {
+	if (priv->ep0_out_data != NULL) {
+		_e967_ep0_out_read(dev);
 		return;
 	}
 
+	/* No data stage armed yet, usbd_ctrl_feed_dout() picks the packet up */
 	priv->ep0_out_size = 1;
 
 	return;
@@ -1130,6 +1436,10 @@ static int _usbd_ctrl_in(const struct device *dev, uint8_t ep)
 
 	ep_cfg = udc_get_ep_cfg(dev, ep);
 	buf = udc_buf_peek(ep_cfg);
+	if (buf == NULL) {
+		/* Flushed by a newer SETUP before the thread got to it */
+		return 0;
+	}
 	bi = udc_get_buf_info(buf);
 
 	if (bi->status) {
@@ -1165,6 +1475,7 @@ static int _usbd_ctrl_in(const struct device *dev, uint8_t ep)
 #endif				
 				udc_set_suspended(dev, true);
 				udc_submit_event(dev, UDC_EVT_SUSPEND, 0);
+				_udc_e967_post_evt(dev, E967_EVT_SUSPEND);
 			}
 
 			priv->is_proc_remote_wakeup = 0;			
@@ -1192,7 +1503,7 @@ void _e967_proc_ep0_d2h(const struct device *dev)
 	struct net_buf *nbuf;
 	uint8_t *data_ptr;
 	uint32_t data_len;
-	uint32_t len, i;
+	uint32_t len;
 	struct udc_buf_info *bi;
 
 	if (priv->ep0_in_size) {
@@ -1219,10 +1530,7 @@ void _e967_proc_ep0_d2h(const struct device *dev)
 		len = data_len;
 	}
 
-	for (i = 0; i < len; i++) {
-		*(priv->reg_ep0_data_buf) = *data_ptr;
-		data_ptr++;
-	}
+	_e967_fifo_write(priv->reg_ep0_data_buf, data_ptr, len);
 	priv->reg_ep0_int_en->UDCEP0INT_EN.UDC_EP0_INT_ENBIT.EP0DATREADY = 1;
 
 	net_buf_pull(nbuf, len);
@@ -1261,21 +1569,25 @@ _exit:
 static int _e967_usbd_xfer_in(const struct device *dev, uint8_t ep)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
-	struct udc_ep_config *ep_cfg;
 	struct e967_usbd_ep *ep_ctrl;
+	uint32_t lock_key;
 
 	ep_ctrl = _e967_get_ep(priv, ep);
-	ep_cfg = udc_get_ep_cfg(dev, ep);
 
 #if (__EPX_IN_LOG__ > 1)
 	printk("[INFO] _e967_usbd_xfer_in, ep=0x%02x\n", ep);
 #endif
+	lock_key = irq_lock();
+
+	/* The IN interrupt loads the first packet once it is enabled again */
 	if (ep_ctrl->data_size_in) {
 		ep_ctrl->reg_ep_int_en->UDCEPx_INT_EN.UDC_EPx_INT_ENBIT.EPxININTEN = 0;
 		ep_ctrl->data_size_in = 0;
 		ep_ctrl->reg_ep_int_en->UDCEPx_INT_EN.UDC_EPx_INT_ENBIT.EPxININTEN = 1;
 	}
 
+	irq_unlock(lock_key);
+
 	return 0;
 }
 
@@ -1286,11 +1598,13 @@ static void _e967_proc_epx_d2h(const struct device *dev, uint8_t ep_addr)
 	struct e967_usbd_ep *ep_ctrl;
 	struct net_buf *nbuf;
 	uint8_t *data_ptr;
-	uint32_t data_len, len, i;
+	uint32_t data_len, len;
+	uint16_t mps;
 	int err;
 
 	ep_ctrl = _e967_get_ep(priv, ep_addr);
 	ep_cfg = udc_get_ep_cfg(dev, ep_addr);
+	mps = _e967_ep_mps(dev, ep_cfg);
 	nbuf = udc_buf_peek(ep_cfg);
 
 #if (__EPX_IN_LOG__ > 2)
@@ -1318,16 +1632,11 @@ static void _e967_proc_epx_d2h(const struct device *dev, uint8_t ep_addr)
 	} while (priv->reg_udc_ctrl1->UDC_CTRL1_.UDCCTRL1BIT.EPINPREHOLD != 1);
 
 	len = data_len;
-	if (len > EP_MPS) {
-		len = EP_MPS;
+	if (len > mps) {
+		len = mps;
 	}
 	*(ep_ctrl->reg_data_cnt) = len;
-	if (len > 0) {
-		for (i = 0; i < len; i++) {
-			*(ep_ctrl->reg_data_buf) = *data_ptr;
-			data_ptr++;
-		}
-	}
+	_e967_fifo_write(ep_ctrl->reg_data_buf, data_ptr, len);
 	ep_ctrl->reg_ep_int_en->UDCEPx_INT_EN.UDC_EPx_INT_ENBIT.EPxDATREADY = 1;
 
 	priv->reg_udc_ctrl1->UDC_CTRL1_.UDCCTRL1BIT.EPINPREHOLD = 0;
@@ -1357,47 +1666,42 @@ _exit:
 	ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_IN_INT_SF_CLR = 1;
 }
 
-static void e967_usb_ep_d2h_isr(const struct device *dev)
+/*
+ * Snapshot the status word of every data endpoint once, then service all of
+ * them, so endpoints that complete together cost one interrupt entry.
+ */
+static uint32_t _e967_epx_pending(struct udc_e967_data *priv, uint32_t flag)
 {
-	struct udc_e967_data *priv = udc_get_private(dev);
-	struct e967_usbd_ep *ep_ctrl;
-	//	uint32_t istry=0;
-	//	uint8_t ep_idx;
+	uint32_t pending = 0;
 
-	if (priv->reg_ep0_int_sts->UDC_EP0_INTSTA.UDC_EP0_INT_STABIT.EP0ININTSF == 1) {
-		_e967_proc_ep0_d2h(dev);
-		return;
+	for (size_t i = 0; i < ARRAY_SIZE(priv->epx_ctrl); i++) {
+		if (priv->epx_ctrl[i].reg_ep_int_sta->UDC_EPx_INTSTA.UDCEPx_INT_STA & flag) {
+			pending |= BIT(i + 1);
+		}
 	}
 
-	ep_ctrl = _e967_get_ep(priv, USB_EP_DIR_IN | 1);
-	if (ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_IN_INT_SF == 1) {
-		_e967_proc_epx_d2h(dev, USB_EP_DIR_IN | 1);
-		return;
-	}
+	return pending;
+}
 
-	ep_ctrl = _e967_get_ep(priv, USB_EP_DIR_IN | 2);
-	if (ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_IN_INT_SF == 1) {
-		_e967_proc_epx_d2h(dev, USB_EP_DIR_IN | 2);
-		return;
-	}
+static void e967_usb_ep_d2h_isr(const struct device *dev)
+{
+	struct udc_e967_data *priv = udc_get_private(dev);
+	uint32_t ep0_sta;
+	uint32_t pending;
+	int idx;
 
-	ep_ctrl = _e967_get_ep(priv, USB_EP_DIR_IN | 3);
-	if (ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_IN_INT_SF == 1) {
-		_e967_proc_epx_d2h(dev, USB_EP_DIR_IN | 3);
-		return;
-	}
+	ep0_sta = priv->reg_ep0_int_sts->UDC_EP0_INTSTA.UDCEP0_INT_STA;
+	pending = _e967_epx_pending(priv, E967_EPX_STA_IN);
 
-	ep_ctrl = _e967_get_ep(priv, USB_EP_DIR_IN | 4);
-	if (ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_IN_INT_SF == 1) {
-		_e967_proc_epx_d2h(dev, USB_EP_DIR_IN | 4);
-		return;
+	if (ep0_sta & E967_EP0_STA_IN) {
+		_e967_proc_ep0_d2h(dev);
 	}
 
-#if 0
-	printk("[ERROR] unkown d2h interrupt\n");
-#endif
-
-	return;
+	while (pending != 0) {
+		idx = find_lsb_set(pending) - 1;
+		pending &= ~BIT(idx);
+		_e967_proc_epx_d2h(dev, USB_EP_DIR_IN | idx);
+	}
 }
 
 static int _e967_usbd_xfer_out(const struct device *dev, uint8_t ep)
@@ -1408,7 +1712,8 @@ static int _e967_usbd_xfer_out(const struct device *dev, uint8_t ep)
 	struct e967_usbd_ep *ep_ctrl;
 	struct net_buf *buf;
 	uint8_t *data_ptr;
-	uint32_t data_len, len, i;
+	uint32_t data_len, len;
+	uint16_t mps;
 	uint32_t isDataOut;
 	uint32_t lock_key;
 	//	int empty;
@@ -1418,6 +1723,7 @@ static int _e967_usbd_xfer_out(const struct device *dev, uint8_t ep)
 
 	ep_ctrl = _e967_get_ep(priv, ep);
 	ep_cfg = udc_get_ep_cfg(dev, ep);
+	mps = _e967_ep_mps(dev, ep_cfg);
 
 	buf = udc_buf_peek(ep_cfg);
 	if (buf == NULL) {
@@ -1457,24 +1763,21 @@ static int _e967_usbd_xfer_out(const struct device *dev, uint8_t ep)
 
 	len = *(ep_ctrl->reg_data_cnt);
 	len = len >> 16;
-	if (len > EP_MPS) {
-		len = EP_MPS;
+	if (len > mps) {
+		len = mps;
 	}
 	if (len > data_len) {
 		len = data_len;
 	}
 
-	for (i = 0; i < len; i++) {
-		*data_ptr = *(ep_ctrl->reg_data_buf);
-		data_ptr++;
-	}
+	_e967_fifo_read(ep_ctrl->reg_data_buf, data_ptr, len);
 
 	priv->reg_udc_ctrl1->UDC_CTRL1_.UDCCTRL1BIT.EPINPREHOLD = 0;
 	net_buf_add(buf, len);
 
 	data_len = net_buf_tailroom(buf);
-	// if( data_len == 0) {
-	if (data_len < EP_MPS) {
+	/* A short packet or a full buffer ends the transfer */
+	if (len < mps || data_len < mps) {
 		buf = udc_buf_get(ep_cfg);
 		udc_submit_ep_event(dev, buf, 0);
 	}
@@ -1501,7 +1804,8 @@ static void _e967_proc_epx_h2d(const struct device *dev, uint8_t ep_addr)
 	struct e967_usbd_ep *ep_ctrl;
 	struct net_buf *nbuf;
 	uint8_t *data_ptr;
-	uint32_t data_len, len, i;
+	uint32_t data_len, len;
+	uint16_t mps;
 
 #if (__EPX_OUT_LOG__ > 1)
 	printk("[INFO] epx_h2d + ep:0x%02x\n", ep_addr);
@@ -1509,6 +1813,7 @@ static void _e967_proc_epx_h2d(const struct device *dev, uint8_t ep_addr)
 
 	ep_ctrl = _e967_get_ep(priv, ep_addr);
 	ep_cfg = udc_get_ep_cfg(dev, ep_addr);
+	mps = _e967_ep_mps(dev, ep_cfg);
 	nbuf = udc_buf_peek(ep_cfg);
 
 	ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_OUT_INT_SF_CLR = 1;
@@ -1557,19 +1862,14 @@ static void _e967_proc_epx_h2d(const struct device *dev, uint8_t ep_addr)
 
 	len = *(ep_ctrl->reg_data_cnt);
 	len = len >> 16;
-	if (len > EP_MPS) {
-		len = EP_MPS;
+	if (len > mps) {
+		len = mps;
 	}
 	if (len > data_len) {
 		len = data_len;
 	}
 
-	if (len > 0) {
-		for (i = 0; i < len; i++) {
-			*data_ptr = *(ep_ctrl->reg_data_buf);
-			data_ptr++;
-		}
-	}
+	_e967_fifo_read(ep_ctrl->reg_data_buf, data_ptr, len);
 
 	priv->reg_udc_ctrl1->UDC_CTRL1_.UDCCTRL1BIT.EPINPREHOLD = 0;
 
@@ -1581,7 +1881,7 @@ static void _e967_proc_epx_h2d(const struct device *dev, uint8_t ep_addr)
 #if (__EPX_OUT_LOG__ > 1)
 	printk("[INFO] epx_h2d done, ep=0x%02x, size=%i\n", ep_addr, data_len);
 #endif
-	if (data_len < EP_MPS) {
+	if (len < mps || data_len < mps) {
 		nbuf = udc_buf_get(ep_cfg);
 		udc_submit_ep_event(dev, nbuf, 0);
 	}
@@ -1592,39 +1892,21 @@ static void _e967_proc_epx_h2d(const struct device *dev, uint8_t ep_addr)
 static void e967_usb_ep_h2d_isr(const struct device *dev)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
-	struct e967_usbd_ep *ep_ctrl;
-
-	if (priv->reg_ep0_int_sts->UDC_EP0_INTSTA.UDC_EP0_INT_STABIT.EP0OUTINTSF == 1) {
-		_e967_proc_ep0_h2d(dev);
-	} else {
+	uint32_t ep0_sta;
+	uint32_t pending;
+	int idx;
 
-		ep_ctrl = _e967_get_ep(priv, USB_EP_DIR_OUT | 1);
-		if (ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_OUT_INT_SF ==
-		    1) {
-			_e967_proc_epx_h2d(dev, USB_EP_DIR_OUT | 1);
-			return;
-		}
+	ep0_sta = priv->reg_ep0_int_sts->UDC_EP0_INTSTA.UDCEP0_INT_STA;
+	pending = _e967_epx_pending(priv, E967_EPX_STA_OUT);
 
-		ep_ctrl = _e967_get_ep(priv, USB_EP_DIR_OUT | 2);
-		if (ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_OUT_INT_SF ==
-		    1) {
-			_e967_proc_epx_h2d(dev, USB_EP_DIR_OUT | 2);
-			return;
-		}
-
-		ep_ctrl = _e967_get_ep(priv, USB_EP_DIR_OUT | 3);
-		if (ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_OUT_INT_SF ==
-		    1) {
-			_e967_proc_epx_h2d(dev, USB_EP_DIR_OUT | 3);
-			return;
-		}
+	if (ep0_sta & E967_EP0_STA_OUT) {
+		_e967_proc_ep0_h2d(dev);
+	}
 
-		ep_ctrl = _e967_get_ep(priv, USB_EP_DIR_OUT | 4);
-		if (ep_ctrl->reg_ep_int_sta->UDC_EPx_INTSTA.UDC_EPx_INT_STABIT.EPx_OUT_INT_SF ==
-		    1) {
-			_e967_proc_epx_h2d(dev, USB_EP_DIR_OUT | 4);
-			return;
-		}
+	while (pending != 0) {
+		idx = find_lsb_set(pending) - 1;
+		pending &= ~BIT(idx);
+		_e967_proc_epx_h2d(dev, USB_EP_DIR_OUT | idx);
 	}
 }
 
@@ -1679,6 +1961,22 @@ static int udc_e967_ep_enable(const struct device *dev, struct udc_ep_config *co
 	return 0;
 }
 
+/*
+ * Endpoint enable from the stack, done on SET_CONFIGURATION. The class OUT
+ * endpoint is served by EP3, as _get_out_pipe_num() told the host.
+ */
+static int udc_e967_ep_enable_api(const struct device *dev, struct udc_ep_config *const cfg)
+{
+	struct udc_e967_data *priv = udc_get_private(dev);
+
+	if (USB_EP_DIR_IS_OUT(cfg->addr) && USB_EP_GET_IDX(cfg->addr) != 0) {
+		priv->ep_out_num = cfg->addr;
+		priv->ep_out_num_new = E967_REMAP_OUT_EP;
+	}
+
+	return udc_e967_ep_enable(dev, cfg);
+}
+
 static int udc_e967_ep_disable(const struct device *dev, struct udc_ep_config *const cfg)
 {
 	struct udc_e967_data *priv = udc_get_private(dev);
@@ -1737,6 +2035,14 @@ static int udc_e967_set_address(const struct device *dev, const uint8_t addr)
 
 static int udc_e967_enable(const struct device *dev)
 {
+	struct udc_e967_data *priv = udc_get_private(dev);
+
+	/* Connect once the clocks are up, see udc_e967_clk_work_handler() */
+	if (priv->hw_init_pending) {
+		priv->connect_pending = true;
+		return 0;
+	}
+
 	/* S/W connect */
 	_e967_usbd_sw_connect(dev);
 
@@ -1745,6 +2051,13 @@ static int udc_e967_enable(const struct device *dev)
 
 static int udc_e967_disable(const struct device *dev)
 {
+	struct udc_e967_data *priv = udc_get_private(dev);
+
+	priv->connect_pending = false;
+	if (priv->hw_init_pending) {
+		return 0;
+	}
+
 	/* S/W disconnect */
 	_e967_usbd_sw_disconnect(dev);
 
@@ -1779,26 +2092,73 @@ void _enable_all_ep(const struct device *dev)
 	udc_e967_ep_enable(dev, cfg);
 }
 
-static int udc_e967_init(const struct device *dev)
+/* Controller setup, needs the USB clock running */
+static void _e967_udc_hw_init(const struct device *dev)
 {
 	const struct udc_e967_config *config = dev->config;
 	struct udc_e967_data *priv = udc_get_private(dev);
 
-	/* Initialize USBD H/W */
-	_e967_usb_clock_set(priv, USB_IRC);
 	_e967_usb_init(priv);
 
 	_e967_usbd_sw_disconnect(dev);
 
+	_enable_all_ep(dev);
+
+	config->irq_enable_func(dev);
+	priv->hw_init_pending = false;
+
+	if (priv->connect_pending) {
+		priv->connect_pending = false;
+		_e967_usbd_sw_connect(dev);
+	}
+}
+
+static void udc_e967_clk_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct udc_e967_data *priv = CONTAINER_OF(dwork, struct udc_e967_data, clk_work);
+	const struct device *dev = priv->dev;
+	uint32_t wait_ms;
+
+	udc_lock_internal(dev, K_FOREVER);
+
+	wait_ms = _e967_usb_clock_step(priv);
+	if (wait_ms != 0) {
+		k_work_schedule(dwork, K_MSEC(wait_ms));
+	} else if (priv->clk_state == E967_CLK_READY && priv->hw_init_pending) {
+		_e967_udc_hw_init(dev);
+	}
+
+	udc_unlock_internal(dev);
+}
+
+static void _e967_usb_clock_kick(struct udc_e967_data *priv)
+{
+	if (priv->clk_state == E967_CLK_OFF) {
+		k_work_schedule(&priv->clk_work, K_MSEC(_e967_usb_clock_start(priv, USB_IRC)));
+	}
+}
+
+static int udc_e967_init(const struct device *dev)
+{
+	struct udc_e967_data *priv = udc_get_private(dev);
+
 	priv->addr = 0;
 	priv->ep_out_num = 0;
 	priv->ep_out_num_new = 0;
+	/* The stack may bring new descriptors after a shutdown */
+	priv->remap_valid = false;
 	
 	_e967_epx_init(dev);
 
-	_enable_all_ep(dev);
+	/* Normally started at boot; again here after a shutdown */
+	_e967_usb_clock_kick(priv);
+	if (priv->clk_state == E967_CLK_READY) {
+		_e967_udc_hw_init(dev);
+	} else {
+		priv->hw_init_pending = true;
+	}
 
-	config->irq_enable_func(dev);
 	if (udc_ep_enable_internal(dev, USB_CONTROL_EP_OUT, USB_EP_TYPE_CONTROL, 8, 0)) {
 		return -EIO;
 	}
@@ -1823,6 +2183,17 @@ static int udc_e967_shutdown(const struct device *dev)
 		return -EIO;
 	}
 
+	/* A bring-up still in progress restarts from scratch on the next init */
+	k_work_cancel_delayable(&priv->clk_work);
+	k_work_cancel_delayable(&priv->pwr_work);
+	k_work_cancel_delayable(&priv->wakeup_work);
+	priv->clk_state = E967_CLK_OFF;
+	priv->pwr_down = false;
+	priv->pwr_relock = false;
+	priv->pwr_wakeup = false;
+	priv->hw_init_pending = false;
+	priv->connect_pending = false;
+
 	/* Uninitialize IRQ */
 	config->irq_disable_func(dev);
 
@@ -1835,8 +2206,9 @@ static int udc_e967_shutdown(const struct device *dev)
 	/* Equivalent to CLK_DisableModuleClock() */
 	CLKGatingEnable(PCLKG_UDC);
 
-	/* Purge message queue */
-	k_msgq_purge(priv->msgq);
+	/* Drop work posted for the old session */
+	atomic_clear(&priv->evt_pending);
+	_e967_ep0_out_drop(priv);
 
 	return 0;
 }
@@ -1845,9 +2217,16 @@ static int udc_e967_driver_preinit(const struct device *dev)
 {
 	const struct udc_e967_config *config = dev->config;
 	struct udc_data *data = dev->data;
+	struct udc_e967_data *priv = udc_get_private(dev);
 	int err;
 	int i;
 
+	priv->dev = dev;
+	k_sem_init(&priv->evt_sem, 0, 1);
+	k_work_init_delayable(&priv->clk_work, udc_e967_clk_work_handler);
+	k_work_init_delayable(&priv->pwr_work, udc_e967_pwr_work_handler);
+	k_work_init_delayable(&priv->wakeup_work, udc_e967_wakeup_work_handler);
+
 	data->caps.hs = false;
 	data->caps.rwup = true;
 	data->caps.addr_before_status = true;
@@ -1880,7 +2259,8 @@ static int udc_e967_driver_preinit(const struct device *dev)
 		config->ep_cfg_out[i].caps.interrupt = 1;
 		config->ep_cfg_out[i].caps.bulk = 1;
 		config->ep_cfg_out[i].caps.iso = 1;
-		config->ep_cfg_out[i].caps.mps = 1023;
+		/* Packets never exceed the endpoint's buffer, nor EP_MPS */
+		config->ep_cfg_out[i].caps.mps = MIN(priv->fifo_depth[i - 1], EP_MPS);
 		config->ep_cfg_out[i].addr = USB_EP_DIR_OUT | i;
 		err = udc_register_ep(dev, &config->ep_cfg_out[i]);
 		if (err != 0) {
@@ -1894,7 +2274,7 @@ static int udc_e967_driver_preinit(const struct device *dev)
 		config->ep_cfg_in[i].caps.interrupt = 1;
 		config->ep_cfg_in[i].caps.bulk = 1;
 		config->ep_cfg_in[i].caps.iso = 1;
-		config->ep_cfg_in[i].caps.mps = 1023;
+		config->ep_cfg_in[i].caps.mps = MIN(priv->fifo_depth[i - 1], EP_MPS);
 		config->ep_cfg_in[i].addr = USB_EP_DIR_IN | i;
 		err = udc_register_ep(dev, &config->ep_cfg_in[i]);
 		if (err != 0) {
@@ -1904,6 +2284,13 @@ static int udc_e967_driver_preinit(const struct device *dev)
 	}
 
 	config->make_thread(dev);
+
+	/*
+	 * Start the oscillator and PLL now; they settle in the background and
+	 * udc_e967_init() finds them ready unless it is called within ~16 ms.
+	 */
+	_e967_usb_clock_kick(priv);
+
 	LOG_INF("Device %p (max. speed %d)", dev, config->speed_idx);
 
 	return 0;
@@ -2000,7 +2387,7 @@ static const struct udc_api udc_e967_api = {
 	.ep_dequeue = udc_e967_ep_dequeue,
 	.ep_set_halt = udc_e967_ep_set_halt,
 	.ep_clear_halt = udc_e967_ep_clear_halt,
-	.ep_enable = udc_e967_ep_enable,
+	.ep_enable = udc_e967_ep_enable_api,
 	.ep_disable = udc_e967_ep_disable,
 	.host_wakeup = udc_e967_host_wakeup,
 	.set_address = udc_e967_set_address,
@@ -2015,26 +2402,33 @@ static const struct udc_api udc_e967_api = {
 
 #ifdef zephyr_official
 #define UDC_E967_DEVICE_DEFINE(inst)                                                               \
+	/* Endpoint data interrupts skip the common ISR wrapper */                                 \
+	ISR_DIRECT_DECLARE(udc_e967_ep_in_isr_##inst)                                              \
+	{                                                                                          \
+		e967_usb_ep_d2h_isr(DEVICE_DT_INST_GET(inst));                                     \
+		ISR_DIRECT_PM();                                                                   \
+		return 1;                                                                          \
+	}                                                                                          \
+	ISR_DIRECT_DECLARE(udc_e967_ep_out_isr_##inst)                                             \
+	{                                                                                          \
+		e967_usb_ep_h2d_isr(DEVICE_DT_INST_GET(inst));                                     \
+		ISR_DIRECT_PM();                                                                   \
+		return 1;                                                                          \
+	}                                                                                          \
+                                                                                                   \
 	static void udc_e967_irq_enable_func(const struct device *dev)                             \
 	{                                                                                          \
-		irq_connect_dynamic(E967_USB_Setup_IRQn, 0,                                        \
-				    (void (*)(const void *))e967_usb_setup_isr,                    \
-				    DEVICE_DT_INST_GET(inst), 0);                                  \
-		irq_connect_dynamic(E967_USB_Suspend_IRQn, 0,                                      \
-				    (void (*)(const void *))e967_usb_suspend_isr,                  \
-				    DEVICE_DT_INST_GET(inst), 0);                                  \
-		irq_connect_dynamic(E967_USB_Resume_IRQn, 0,                                       \
-				    (void (*)(const void *))e967_usb_resume_isr,                   \
-				    DEVICE_DT_INST_GET(inst), 0);                                  \
-		irq_connect_dynamic(E967_USB_Reset_IRQn, 0,                                        \
-				    (void (*)(const void *))e967_usb_reset_isr,                    \
-				    DEVICE_DT_INST_GET(inst), 0);                                  \
-		irq_connect_dynamic(E967_USB_EPx_In_EPx_Empty_IRQn, 0,                             \
-				    (void (*)(const void *))e967_usb_ep_d2h_isr,                   \
-				    DEVICE_DT_INST_GET(inst), 0);                                  \
-		irq_connect_dynamic(E967_USB_EPx_Out_IRQn, 0,                                      \
-				    (void (*)(const void *))e967_usb_ep_h2d_isr,                   \
-				    DEVICE_DT_INST_GET(inst), 0);                                  \
+		IRQ_CONNECT(E967_USB_Setup_IRQn, 0, e967_usb_setup_isr,                            \
+			    DEVICE_DT_INST_GET(inst), 0);                                          \
+		IRQ_CONNECT(E967_USB_Suspend_IRQn, 0, e967_usb_suspend_isr,                        \
+			    DEVICE_DT_INST_GET(inst), 0);                                          \
+		IRQ_CONNECT(E967_USB_Resume_IRQn, 0, e967_usb_resume_isr,                          \
+			    DEVICE_DT_INST_GET(inst), 0);                                          \
+		IRQ_CONNECT(E967_USB_Reset_IRQn, 0, e967_usb_reset_isr,                            \
+			    DEVICE_DT_INST_GET(inst), 0);                                          \
+		IRQ_DIRECT_CONNECT(E967_USB_EPx_In_EPx_Empty_IRQn, 0, udc_e967_ep_in_isr_##inst,   \
+				   0);                                                             \
+		IRQ_DIRECT_CONNECT(E967_USB_EPx_Out_IRQn, 0, udc_e967_ep_out_isr_##inst, 0);       \
 		irq_enable(E967_USB_Setup_IRQn);                                                   \
 		irq_enable(E967_USB_Suspend_IRQn);                                                 \
 		irq_enable(E967_USB_Resume_IRQn);                                                  \
@@ -2087,11 +2481,9 @@ static const struct udc_api udc_e967_api = {
 		.irq_enable_func = udc_e967_irq_enable_func,                                       \
 		.irq_disable_func = udc_e967_irq_disable_func};                                    \
                                                                                                    \
-	K_MSGQ_DEFINE(e967_usbd_msgq_##inst, sizeof(struct udc_e967_msg),                          \
-		      CONFIG_UDC_E967_MSG_QUEUE_SIZE, 4);                                          \
 	static struct udc_e967_data e967_udc_priv_##inst = {                                       \
 		.setup_pkg = {0},                                                                  \
-		.msgq = &e967_usbd_msgq_##inst,                                                    \
+		.fifo_depth = DT_INST_PROP(inst, fifo_depths),                                     \
 		.reg_ep0_data_buf = (volatile uint32_t *)(E967_USB_BASE + 0x38),                   \
 		.reg_ep0_int_sts = UDCEP0INTSTA,                                                   \
 		.reg_ep0_int_en = UDCEP0INTEN,                                                     \
@@ -2193,9 +2585,8 @@ static const struct udc_e967_config udc_e967_config_0 = {
 	.irq_enable_func = udc_e967_irq_enable_func,
 	.irq_disable_func = udc_e967_irq_disable_func};
 
-K_MSGQ_DEFINE(e967_usbd_msgq_0, sizeof(struct udc_e967_msg), CONFIG_UDC_E967_MSG_QUEUE_SIZE, 4);
 static struct udc_e967_data e967_udc_priv_0 = {.setup_pkg = {0},
-					       .msgq = &e967_usbd_msgq_0,
+					       .fifo_depth = {64, 64, 64, 64},
 					       .reg_ep0_data_buf =
 						       (volatile uint32_t *)(E967_USB_BASE + 0x38),
 					       .reg_ep0_int_sts = UDCEP0INTSTA,
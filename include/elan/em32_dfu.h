@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ELAN_EM32_DFU_H__
+#define __ELAN_EM32_DFU_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+/*
+ * Pipelined firmware image writer for the EM32 internal flash.
+ *
+ * Incoming data is staged in two page-sized buffers. While the transport
+ * fills one, a writer thread programs the other, feeds it to the SHA-256
+ * engine and erases the page that follows, so the image digest is ready as
+ * soon as the last page is programmed. No read-back pass is needed.
+ *
+ * The functions are not reentrant; one update runs at a time.
+ */
+
+#define EM32_DFU_DIGEST_SIZE 32
+
+/**
+ * @brief Start an update.
+ *
+ * Erases the first page before returning.
+ *
+ * @param offset Flash offset of the target area, page aligned
+ * @param area_size Size of the target area in bytes
+ * @param image_size Exact image size in bytes, at most @p area_size
+ *
+ * @return 0 on success, -EINVAL on a bad range, -EBUSY if an update is
+ *         running, or a flash or crypto error
+ */
+int em32_dfu_begin(off_t offset, size_t area_size, size_t image_size);
+
+/**
+ * @brief Append image data.
+ *
+ * Copies @p buf into the current page buffer. Blocks only while both
+ * buffers are waiting to be programmed.
+ *
+ * @return 0 on success, -EFBIG past the image size, or the error of an
+ *         earlier page (the update is then dead and must be aborted)
+ */
+int em32_dfu_write(const uint8_t *buf, size_t len);
+
+/**
+ * @brief Program the last page and return the image digest.
+ *
+ * @param digest SHA-256 of the @p image_size bytes given to em32_dfu_begin()
+ *
+ * @return 0 on success, -ENODATA if fewer bytes were written than
+ *         announced, or the first error of the update
+ */
+int em32_dfu_finish(uint8_t digest[EM32_DFU_DIGEST_SIZE]);
+
+/**
+ * @brief Drop a running update after the page in flight is programmed.
+ */
+void em32_dfu_abort(void);
+
+#endif /* __ELAN_EM32_DFU_H__ */
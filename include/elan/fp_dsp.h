@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ELAN_FP_DSP_H__
+#define __ELAN_FP_DSP_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Image kernels for 8-bit fingerprint sensor frames, stored row by row.
+ *
+ * Each kernel has a scalar reference version with the _ref suffix that
+ * produces bit-identical results. The plain versions use the Cortex-M4
+ * SIMD instructions when the core has the DSP extension and fall back to
+ * the reference code otherwise. Input and output may be the same buffer
+ * except for fp_dsp_filter3x3().
+ */
+
+/**
+ * @brief Subtract a background frame: out = max(in - bg, 0).
+ */
+void fp_dsp_bg_subtract(const uint8_t *in, const uint8_t *bg, uint8_t *out, size_t n);
+void fp_dsp_bg_subtract_ref(const uint8_t *in, const uint8_t *bg, uint8_t *out, size_t n);
+
+/**
+ * @brief Per-column normalization:
+ * out = min((max(in - offset[x], 0) * gain[x]) >> 8, 255).
+ *
+ * @param offset Per-column black level, @p width entries
+ * @param gain Per-column gain in Q8.8, @p width entries, each below 0x8000
+ */
+void fp_dsp_col_normalize(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+			  const uint8_t *offset, const uint16_t *gain);
+void fp_dsp_col_normalize_ref(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+			      const uint8_t *offset, const uint16_t *gain);
+
+/**
+ * @brief Count pixel values into @p hist, which is cleared first.
+ */
+void fp_dsp_histogram(const uint8_t *in, size_t n, uint32_t hist[256]);
+void fp_dsp_histogram_ref(const uint8_t *in, size_t n, uint32_t hist[256]);
+
+/**
+ * @brief Find the stretch range that clips @p clip pixels at either end.
+ */
+void fp_dsp_stretch_range(const uint32_t hist[256], size_t clip, uint8_t *lo, uint8_t *hi);
+
+/**
+ * @brief Linear contrast stretch of [lo, hi] onto [0, 255]:
+ * out = clamp((in - lo) * 255 / (hi - lo)). Copies when hi <= lo.
+ */
+void fp_dsp_contrast_stretch(const uint8_t *in, uint8_t *out, size_t n, uint8_t lo, uint8_t hi);
+void fp_dsp_contrast_stretch_ref(const uint8_t *in, uint8_t *out, size_t n, uint8_t lo,
+				 uint8_t hi);
+
+/**
+ * @brief 3x3 convolution: out = clamp(sum(k[i] * in[i]) >> shift, 0, 255).
+ *
+ * The kernel is given row by row. Border pixels are copied unfiltered.
+ * @p in and @p out must not overlap.
+ */
+void fp_dsp_filter3x3(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+		      const int8_t kernel[9], uint8_t shift);
+void fp_dsp_filter3x3_ref(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+			  const int8_t kernel[9], uint8_t shift);
+
+#endif /* __ELAN_FP_DSP_H__ */
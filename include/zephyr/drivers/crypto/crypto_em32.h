@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ZEPHYR_INCLUDE_DRIVERS_CRYPTO_EM32_H__
+#define __ZEPHYR_INCLUDE_DRIVERS_CRYPTO_EM32_H__
+
+#include <stddef.h>
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+/**
+ * @brief Announce the total length of the message being hashed.
+ *
+ * The first chunk then programs the engine with the total byte count and
+ * every following hash_update() is streamed to the engine without being
+ * buffered. Call it after hash_begin_session() and before the first update.
+ *
+ * @param dev EM32 SHA device
+ * @param total_bytes Length of the whole message in bytes
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @p dev is NULL
+ */
+int crypto_em32_sha_set_total_length(const struct device *dev, size_t total_bytes);
+
+/**
+ * @brief Take exclusive use of the ENCRYPT block.
+ *
+ * The SHA and AES cores share the block's clock, reset and interrupt line.
+ * The SHA driver holds this lock for each engine operation; any driver
+ * that programs the AES registers must hold it while doing so.
+ *
+ * @param dev EM32 crypto device
+ * @param timeout How long to wait for the block to be free
+ *
+ * @retval 0 on success
+ * @retval -EBUSY if @p timeout is K_NO_WAIT and the block is in use
+ * @retval -EAGAIN if the block stayed in use for @p timeout
+ */
+int crypto_em32_lock(const struct device *dev, k_timeout_t timeout);
+
+/**
+ * @brief Release the ENCRYPT block taken with crypto_em32_lock().
+ *
+ * @param dev EM32 crypto device
+ */
+void crypto_em32_unlock(const struct device *dev);
+
+#endif /* __ZEPHYR_INCLUDE_DRIVERS_CRYPTO_EM32_H__ */
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ZEPHYR_INCLUDE_DRIVERS_DMA_EM32_H__
+#define __ZEPHYR_INCLUDE_DRIVERS_DMA_EM32_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Memory copy/fill offload on the EM32F967 DMA controller.
+ *
+ * Requests shorter than CONFIG_DMA_EM32_MEMCPY_THRESHOLD, issued before the
+ * kernel is up, or (for the blocking calls) issued from an ISR are served by
+ * the CPU. Unaligned heads and tails are copied by the CPU as well, so any
+ * buffer/length combination is accepted. Source and destination must not
+ * overlap.
+ */
+
+/**
+ * @brief Completion callback of an asynchronous copy or fill.
+ *
+ * Called from the DMA interrupt when the engine was used, or from the
+ * caller's context before dma_em32_*_async() returns when the CPU fallback
+ * was taken.
+ *
+ * @param status 0 when the range is complete. Negative errno if the engine
+ *               failed; the range may then be partly written and is not
+ *               redone, so the caller should retry it, e.g. with the
+ *               blocking call, which finishes on the CPU.
+ * @param user_data Pointer passed to dma_em32_*_async()
+ */
+typedef void (*dma_em32_copy_cb_t)(int status, void *user_data);
+
+#if defined(CONFIG_DMA_EM32_MEMCPY)
+
+/**
+ * @brief Copy @p len bytes, blocking until the copy has completed.
+ *
+ * @return 0 on success, negative errno otherwise
+ */
+int dma_em32_memcpy(void *dst, const void *src, size_t len);
+
+/**
+ * @brief Fill @p len bytes with @p val, blocking until done.
+ *
+ * @return 0 on success, negative errno otherwise
+ */
+int dma_em32_memset(void *dst, uint8_t val, size_t len);
+
+/**
+ * @brief Start a copy and return immediately.
+ *
+ * If the offload channel is busy the copy is done by the CPU. Buffers must
+ * stay valid until @p cb runs.
+ *
+ * @return 0 if the copy was started or completed, negative errno otherwise
+ */
+int dma_em32_memcpy_async(void *dst, const void *src, size_t len, dma_em32_copy_cb_t cb,
+			  void *user_data);
+
+/**
+ * @brief Start a fill and return immediately.
+ *
+ * @return 0 if the fill was started or completed, negative errno otherwise
+ */
+int dma_em32_memset_async(void *dst, uint8_t val, size_t len, dma_em32_copy_cb_t cb,
+			  void *user_data);
+
+#else /* !CONFIG_DMA_EM32_MEMCPY */
+
+static inline int dma_em32_memcpy(void *dst, const void *src, size_t len)
+{
+	memcpy(dst, src, len);
+	return 0;
+}
+
+static inline int dma_em32_memset(void *dst, uint8_t val, size_t len)
+{
+	memset(dst, val, len);
+	return 0;
+}
+
+static inline int dma_em32_memcpy_async(void *dst, const void *src, size_t len,
+					dma_em32_copy_cb_t cb, void *user_data)
+{
+	memcpy(dst, src, len);
+	if (cb != NULL) {
+		cb(0, user_data);
+	}
+	return 0;
+}
+
+static inline int dma_em32_memset_async(void *dst, uint8_t val, size_t len,
+					dma_em32_copy_cb_t cb, void *user_data)
+{
+	memset(dst, val, len);
+	if (cb != NULL) {
+		cb(0, user_data);
+	}
+	return 0;
+}
+
+#endif /* CONFIG_DMA_EM32_MEMCPY */
+
+#endif //__ZEPHYR_INCLUDE_DRIVERS_DMA_EM32_H__
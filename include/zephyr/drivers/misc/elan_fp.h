@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ZEPHYR_INCLUDE_DRIVERS_MISC_ELAN_FP_H__
+#define __ZEPHYR_INCLUDE_DRIVERS_MISC_ELAN_FP_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/device.h>
+
+/*
+ * Continuous frame capture from an Elan fingerprint sensor.
+ *
+ * Frames are read into two buffers in turn. The read of the next frame is
+ * started before the finished one is handed to the application, so the
+ * SPI bus stays busy while the frame-ready callback runs.
+ */
+
+/**
+ * @brief Frame-ready callback, called from the capture thread.
+ *
+ * @param dev Sensor device
+ * @param frame Captured frame; valid until the next frame-ready callback
+ * @param len Frame size in bytes
+ * @param status 0, or negative errno if the read failed (@p frame is then
+ *               NULL and capture stops)
+ * @param user_data Pointer passed to elan_fp_capture_start()
+ */
+typedef void (*elan_fp_frame_cb_t)(const struct device *dev, const uint8_t *frame, size_t len,
+				   int status, void *user_data);
+
+/**
+ * @brief Start continuous capture.
+ *
+ * @return 0 on success, -EALREADY if capture is running
+ */
+int elan_fp_capture_start(const struct device *dev, elan_fp_frame_cb_t cb, void *user_data);
+
+/**
+ * @brief Stop capture after the frame being clocked in.
+ *
+ * No callback is made for that frame.
+ *
+ * @return 0 on success, -EALREADY if capture is not running
+ */
+int elan_fp_capture_stop(const struct device *dev);
+
+/**
+ * @brief Size of one frame in bytes.
+ */
+size_t elan_fp_frame_size(const struct device *dev);
+
+#endif //__ZEPHYR_INCLUDE_DRIVERS_MISC_ELAN_FP_H__
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ZEPHYR_INCLUDE_DRIVERS_SPI_EM32_H__
+#define __ZEPHYR_INCLUDE_DRIVERS_SPI_EM32_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/spi.h>
+
+/*
+ * Peripheral (target) mode of the EM32 SPI controller.
+ *
+ * While started, the RX DMA channel runs continuously into a ring buffer
+ * of CONFIG_SPI_EM32_TARGET_RING_SIZE bytes, so host bursts are absorbed
+ * without per-byte interrupts. The TX channel is armed with the response
+ * for the next frame while chip-select is deasserted. Frame boundaries
+ * are taken from the edges of the node's target-cs-gpios line.
+ */
+
+/**
+ * @brief Frame callback, called from the system work queue after the host
+ * deasserts chip-select. The next frame's response is armed before it
+ * runs.
+ *
+ * @param dev SPI device
+ * @param len Number of bytes received in the frame, available through
+ *            spi_em32_target_read()
+ * @param status 0, or -ENOBUFS if unread data was overwritten in the ring
+ * @param user_data Pointer passed to spi_em32_target_start()
+ */
+typedef void (*spi_em32_target_cb_t)(const struct device *dev, size_t len, int status,
+				     void *user_data);
+
+/**
+ * @brief Switch the controller to peripheral mode and start receiving.
+ *
+ * The bus stays owned by the target until spi_em32_target_stop().
+ * Only 8-bit frames are supported.
+ *
+ * @return 0 on success, negative errno otherwise
+ */
+int spi_em32_target_start(const struct device *dev, const struct spi_config *config,
+			  spi_em32_target_cb_t cb, void *user_data);
+
+/**
+ * @brief Arm the response clocked out during the next frame.
+ *
+ * Takes effect immediately while chip-select is deasserted, otherwise at
+ * the end of the current frame. The buffer must stay valid until the
+ * frame it is sent in has ended. Bytes the host clocks beyond @p len are
+ * undefined.
+ *
+ * @return 0 on success, negative errno otherwise
+ */
+int spi_em32_target_set_response(const struct device *dev, const uint8_t *buf, size_t len);
+
+/**
+ * @brief Copy received bytes out of the ring buffer.
+ *
+ * @return Number of bytes copied, or negative errno
+ */
+int spi_em32_target_read(const struct device *dev, uint8_t *buf, size_t len);
+
+/**
+ * @brief Stop peripheral mode and release the bus.
+ *
+ * @return 0 on success, negative errno otherwise
+ */
+int spi_em32_target_stop(const struct device *dev);
+
+#endif //__ZEPHYR_INCLUDE_DRIVERS_SPI_EM32_H__
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ZEPHYR_INCLUDE_DT_BINDINGS_DMA_EM32F967_DMA_H__
+#define __ZEPHYR_INCLUDE_DT_BINDINGS_DMA_EM32F967_DMA_H__
+
+/** DMA hardware handshake IDs (slot cell of the dmas property) **/
+#define EM32_DMA_HS_MEMORY    0x00
+#define EM32_DMA_HS_UART1_TX  0x01
+#define EM32_DMA_HS_UART1_RX  0x02
+#define EM32_DMA_HS_SSP2_TX   0x06
+#define EM32_DMA_HS_SSP2_RX   0x07
+#define EM32_DMA_HS_SPI1_TX   0x08
+#define EM32_DMA_HS_SPI1_RX   0x09
+
+#endif //__ZEPHYR_INCLUDE_DT_BINDINGS_DMA_EM32F967_DMA_H__
@@ -0,0 +1,392 @@
+/*
+ * Pipelined firmware image writer
+ *
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/crypto/crypto.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include "../../include/zephyr/drivers/crypto/crypto_em32.h"
+#include "../../include/zephyr/drivers/flash/flash_em32.h"
+#include "../../include/elan/em32_dfu.h"
+
+LOG_MODULE_REGISTER(em32_dfu, LOG_LEVEL_INF);
+
+#define EM32_DFU_PAGE_SIZE  EM32_NV_FLASH_PAGE_SIZE
+#define EM32_DFU_WRITE_SIZE EM32_NV_FLASH_WRITE_BLOCK_SIZE
+
+struct em32_dfu_job {
+	uint8_t *buf;
+	off_t offset;
+	size_t len;
+	bool last;
+};
+
+struct em32_dfu_data {
+	const struct device *flash;
+	const struct device *sha;
+	struct hash_ctx ctx;
+	bool active;
+	off_t offset;
+	size_t area_size;
+	size_t image_size;
+	/* Bytes accepted by em32_dfu_write() */
+	size_t received;
+	/* Page buffer being filled and its fill level */
+	int cur;
+	size_t fill;
+	/* First error seen by the writer thread */
+	atomic_t err;
+	/* Page buffers not owned by the writer thread */
+	struct k_sem free;
+	struct k_sem done;
+	struct k_msgq jobs;
+	struct em32_dfu_job job_buf[2];
+	uint8_t digest[EM32_DFU_DIGEST_SIZE] __aligned(4);
+};
+
+/* Written whole by flash_em32_write(), one word at a time */
+static uint8_t em32_dfu_pages[2][EM32_DFU_PAGE_SIZE] __aligned(4) __noinit;
+
+static struct em32_dfu_data em32_dfu = {
+	.flash = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller)),
+	.sha = DEVICE_DT_GET(DT_NODELABEL(crypto0)),
+};
+
+static void em32_dfu_fail(int ret)
+{
+	atomic_cas(&em32_dfu.err, 0, ret);
+}
+
+static int em32_dfu_hash(const uint8_t *buf, size_t len)
+{
+	struct hash_pkt pkt = {
+		.in_buf = (uint8_t *)buf,
+		.in_len = len,
+	};
+
+	return hash_update(&em32_dfu.ctx, &pkt);
+}
+
+/*
+ * Program one page, hash it while it is still in RAM, give the buffer back
+ * and erase the page after it. The erase overlaps the transport filling the
+ * other buffer, so the next page is ready to program when it arrives.
+ */
+static void em32_dfu_program(const struct em32_dfu_job *job)
+{
+	off_t next = job->offset + EM32_DFU_PAGE_SIZE;
+	int ret;
+
+	if (atomic_get(&em32_dfu.err) != 0 || job->len == 0) {
+		k_sem_give(&em32_dfu.free);
+		return;
+	}
+
+	/* Pad the tail of the image to the write block with erased bytes */
+	size_t wlen = ROUND_UP(job->len, EM32_DFU_WRITE_SIZE);
+
+	memset(job->buf + job->len, 0xFF, wlen - job->len);
+
+	ret = flash_write(em32_dfu.flash, job->offset, job->buf, wlen);
+	if (ret == 0) {
+		ret = em32_dfu_hash(job->buf, job->len);
+	}
+
+	k_sem_give(&em32_dfu.free);
+
+	if (ret == 0 && !job->last && next < em32_dfu.offset + (off_t)em32_dfu.area_size) {
+		ret = flash_erase(em32_dfu.flash, next, EM32_DFU_PAGE_SIZE);
+	}
+
+	if (ret < 0) {
+		LOG_ERR("Page at 0x%lx failed %d", (long)job->offset, ret);
+		em32_dfu_fail(ret);
+	}
+}
+
+static void em32_dfu_thread(void *p1, void *p2, void *p3)
+{
+	struct em32_dfu_job job;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		k_msgq_get(&em32_dfu.jobs, &job, K_FOREVER);
+
+		em32_dfu_program(&job);
+
+		if (job.last) {
+			k_sem_give(&em32_dfu.done);
+		}
+	}
+}
+
+K_THREAD_DEFINE(em32_dfu_tid, CONFIG_ELAN_EM32_DFU_THREAD_STACK_SIZE, em32_dfu_thread, NULL, NULL,
+		NULL, K_PRIO_PREEMPT(CONFIG_ELAN_EM32_DFU_THREAD_PRIORITY), 0, 0);
+
+/* Hand the current buffer to the writer thread and take the other one */
+static void em32_dfu_submit(bool last)
+{
+	struct em32_dfu_job job = {
+		.buf = em32_dfu_pages[em32_dfu.cur],
+		.offset = em32_dfu.offset + (off_t)(em32_dfu.received - em32_dfu.fill),
+		.len = em32_dfu.fill,
+		.last = last,
+	};
+
+	/* Never blocks: at most two jobs are out and the queue holds two */
+	k_msgq_put(&em32_dfu.jobs, &job, K_FOREVER);
+
+	em32_dfu.cur ^= 1;
+	em32_dfu.fill = 0;
+}
+
+/* Wait until the writer thread is idle and owns no buffer */
+static void em32_dfu_drain(void)
+{
+	k_sem_take(&em32_dfu.free, K_FOREVER);
+	k_sem_take(&em32_dfu.free, K_FOREVER);
+	k_sem_give(&em32_dfu.free);
+	k_sem_give(&em32_dfu.free);
+}
+
+static void em32_dfu_end(void)
+{
+	hash_free_session(em32_dfu.sha, &em32_dfu.ctx);
+	em32_dfu.active = false;
+}
+
+int em32_dfu_begin(off_t offset, size_t area_size, size_t image_size)
+{
+	int ret;
+
+	if (em32_dfu.active) {
+		return -EBUSY;
+	}
+
+	if (offset < 0 || (offset % EM32_DFU_PAGE_SIZE) != 0 || image_size == 0 ||
+	    image_size > area_size || offset + area_size > EM32_NV_FLASH_SIZE) {
+		return -EINVAL;
+	}
+
+	if (!device_is_ready(em32_dfu.flash) || !device_is_ready(em32_dfu.sha)) {
+		return -ENODEV;
+	}
+
+	memset(&em32_dfu.ctx, 0, sizeof(em32_dfu.ctx));
+	em32_dfu.ctx.flags = CAP_SYNC_OPS | CAP_SEPARATE_IO_BUFS;
+	ret = hash_begin_session(em32_dfu.sha, &em32_dfu.ctx, CRYPTO_HASH_ALGO_SHA256);
+	if (ret < 0) {
+		return ret;
+	}
+	crypto_em32_sha_set_total_length(em32_dfu.sha, image_size);
+
+	ret = flash_erase(em32_dfu.flash, offset, EM32_DFU_PAGE_SIZE);
+	if (ret < 0) {
+		hash_free_session(em32_dfu.sha, &em32_dfu.ctx);
+		return ret;
+	}
+
+	em32_dfu.offset = offset;
+	em32_dfu.area_size = area_size;
+	em32_dfu.image_size = image_size;
+	em32_dfu.received = 0;
+	em32_dfu.cur = 0;
+	em32_dfu.fill = 0;
+	atomic_set(&em32_dfu.err, 0);
+	k_sem_reset(&em32_dfu.done);
+	em32_dfu.active = true;
+
+	LOG_INF("Update of %zu bytes at 0x%lx", image_size, (long)offset);
+
+	return 0;
+}
+
+int em32_dfu_write(const uint8_t *buf, size_t len)
+{
+	int ret;
+
+	if (!em32_dfu.active) {
+		return -EINVAL;
+	}
+
+	ret = atomic_get(&em32_dfu.err);
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (len > em32_dfu.image_size - em32_dfu.received) {
+		return -EFBIG;
+	}
+
+	while (len > 0) {
+		size_t n = MIN(len, EM32_DFU_PAGE_SIZE - em32_dfu.fill);
+
+		if (em32_dfu.fill == 0) {
+			/* Both buffers queued: wait for the writer to free one */
+			k_sem_take(&em32_dfu.free, K_FOREVER);
+		}
+
+		memcpy(&em32_dfu_pages[em32_dfu.cur][em32_dfu.fill], buf, n);
+		em32_dfu.fill += n;
+		em32_dfu.received += n;
+		buf += n;
+		len -= n;
+
+		if (em32_dfu.fill == EM32_DFU_PAGE_SIZE) {
+			em32_dfu_submit(em32_dfu.received == em32_dfu.image_size);
+		}
+	}
+
+	return 0;
+}
+
+int em32_dfu_finish(uint8_t digest[EM32_DFU_DIGEST_SIZE])
+{
+	struct hash_pkt pkt = {
+		.out_buf = em32_dfu.digest,
+	};
+	int ret;
+
+	if (!em32_dfu.active) {
+		return -EINVAL;
+	}
+
+	/* A full last page was already submitted from em32_dfu_write() */
+	if (em32_dfu.received < em32_dfu.image_size) {
+		em32_dfu_abort();
+		return -ENODATA;
+	}
+
+	if (em32_dfu.fill > 0) {
+		em32_dfu_submit(true);
+	}
+
+	k_sem_take(&em32_dfu.done, K_FOREVER);
+	em32_dfu_drain();
+
+	ret = atomic_get(&em32_dfu.err);
+	if (ret == 0) {
+		/* All bytes are in the engine already; this only waits for the last block */
+		ret = hash_compute(&em32_dfu.ctx, &pkt);
+	}
+
+	if (ret == 0) {
+		memcpy(digest, em32_dfu.digest, EM32_DFU_DIGEST_SIZE);
+	}
+
+	em32_dfu_end();
+
+	return ret;
+}
+
+void em32_dfu_abort(void)
+{
+	if (!em32_dfu.active) {
+		return;
+	}
+
+	em32_dfu_fail(-ECANCELED);
+	if (em32_dfu.fill > 0) {
+		em32_dfu_submit(false);
+	}
+	em32_dfu_drain();
+	em32_dfu_end();
+}
+
+static int em32_dfu_init(void)
+{
+	k_sem_init(&em32_dfu.free, 2, 2);
+	k_sem_init(&em32_dfu.done, 0, 1);
+	k_msgq_init(&em32_dfu.jobs, (char *)em32_dfu.job_buf, sizeof(struct em32_dfu_job),
+		    ARRAY_SIZE(em32_dfu.job_buf));
+
+	return 0;
+}
+
+SYS_INIT(em32_dfu_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#if defined(CONFIG_ELAN_EM32_DFU_USBD)
+
+#include <zephyr/usb/class/usbd_dfu.h>
+
+/* Partition addresses in the devicetree are absolute; flash offsets are not */
+#define EM32_DFU_EC_RW_OFFSET (EM32_EC_RW_PARTITION_ADDR - EM32_NV_FLASH_ADDR)
+
+static int em32_dfu_usbd_read(void *const priv, const uint32_t block, const uint16_t size,
+			      uint8_t buf[static CONFIG_USBD_DFU_TRANSFER_SIZE])
+{
+	size_t pos = (size_t)block * CONFIG_USBD_DFU_TRANSFER_SIZE;
+	size_t len;
+	int ret;
+
+	ARG_UNUSED(priv);
+
+	if (pos >= EM32_EC_RW_PARTITION_SIZE) {
+		return 0;
+	}
+
+	len = MIN(size, EM32_EC_RW_PARTITION_SIZE - pos);
+	ret = flash_read(em32_dfu.flash, EM32_DFU_EC_RW_OFFSET + pos, buf, len);
+
+	return ret < 0 ? ret : (int)len;
+}
+
+static int em32_dfu_usbd_write(void *const priv, const uint32_t block, const uint16_t size,
+			       const uint8_t buf[static CONFIG_USBD_DFU_TRANSFER_SIZE])
+{
+	uint8_t digest[EM32_DFU_DIGEST_SIZE];
+	int ret;
+
+	ARG_UNUSED(priv);
+
+	if (block == 0) {
+		/* A download restarted from scratch */
+		em32_dfu_abort();
+		ret = em32_dfu_begin(EM32_DFU_EC_RW_OFFSET, EM32_EC_RW_PARTITION_SIZE,
+				     EM32_EC_RW_PARTITION_SIZE);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* A zero-length block ends the download */
+	if (size == 0) {
+		ret = em32_dfu_finish(digest);
+		if (ret == 0) {
+			LOG_HEXDUMP_INF(digest, sizeof(digest), "ec_rw SHA-256");
+		}
+		return ret;
+	}
+
+	return em32_dfu_write(buf, size);
+}
+
+static bool em32_dfu_usbd_next(void *const priv, const enum usb_dfu_state state,
+			       const enum usb_dfu_state next)
+{
+	ARG_UNUSED(priv);
+
+	/* Host aborted or the device was reset mid-download */
+	if (next == DFU_IDLE && state != DFU_IDLE) {
+		em32_dfu_abort();
+	}
+
+	return true;
+}
+
+USBD_DFU_DEFINE_IMG(ec_rw, "ec_rw", NULL, em32_dfu_usbd_read, em32_dfu_usbd_write,
+		    em32_dfu_usbd_next);
+
+#endif /* CONFIG_ELAN_EM32_DFU_USBD */
@@ -0,0 +1,223 @@
+/*
+ * Fingerprint frame DSP kernels, Cortex-M4 SIMD versions
+ *
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "../../include/elan/fp_dsp.h"
+
+#if defined(__ARM_FEATURE_DSP)
+
+#include <cmsis_core.h>
+
+/* Cortex-M4 LDR/STR handle unaligned words, memcpy compiles to one of them */
+static inline uint32_t fp_load4(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline void fp_store4(uint8_t *p, uint32_t v)
+{
+	memcpy(p, &v, sizeof(v));
+}
+
+void fp_dsp_bg_subtract(const uint8_t *in, const uint8_t *bg, uint8_t *out, size_t n)
+{
+	size_t i = 0;
+
+	/* Four saturating byte subtractions per instruction */
+	for (; i + 4 <= n; i += 4) {
+		fp_store4(out + i, __UQSUB8(fp_load4(in + i), fp_load4(bg + i)));
+	}
+
+	fp_dsp_bg_subtract_ref(in + i, bg + i, out + i, n - i);
+}
+
+void fp_dsp_col_normalize(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+			  const uint8_t *offset, const uint16_t *gain)
+{
+	for (uint32_t y = 0; y < height; y++) {
+		const uint8_t *src = in + y * width;
+		uint8_t *dst = out + y * width;
+		uint32_t x = 0;
+
+		for (; x + 4 <= width; x += 4) {
+			uint32_t d = __UQSUB8(fp_load4(src + x), fp_load4(offset + x));
+			uint32_t even = __UXTB16(d);
+			uint32_t odd = __UXTB16(__ROR(d, 8));
+			/* Gains below 0x8000 keep each product positive as a signed halfword */
+			uint32_t p0 = ((even & 0xFFFFU) * gain[x]) >> 8;
+			uint32_t p1 = ((odd & 0xFFFFU) * gain[x + 1]) >> 8;
+			uint32_t p2 = ((even >> 16) * gain[x + 2]) >> 8;
+			uint32_t p3 = ((odd >> 16) * gain[x + 3]) >> 8;
+
+			/* Saturate two lanes at a time and interleave back to bytes */
+			fp_store4(dst + x, __USAT16(__PKHBT(p0, p2, 16), 8) |
+						   (__USAT16(__PKHBT(p1, p3, 16), 8) << 8));
+		}
+
+		fp_dsp_col_normalize_ref(src + x, dst + x, width - x, 1, offset + x, gain + x);
+	}
+}
+
+void fp_dsp_histogram(const uint8_t *in, size_t n, uint32_t hist[256])
+{
+	size_t i = 0;
+
+	memset(hist, 0, 256 * sizeof(hist[0]));
+
+	/* One word load per four pixels */
+	for (; i + 4 <= n; i += 4) {
+		uint32_t w = fp_load4(in + i);
+
+		hist[w & 0xFFU]++;
+		hist[(w >> 8) & 0xFFU]++;
+		hist[(w >> 16) & 0xFFU]++;
+		hist[w >> 24]++;
+	}
+
+	for (; i < n; i++) {
+		hist[in[i]]++;
+	}
+}
+
+void fp_dsp_contrast_stretch(const uint8_t *in, uint8_t *out, size_t n, uint8_t lo, uint8_t hi)
+{
+	uint8_t lut[256];
+	size_t i = 0;
+
+	if (hi <= lo) {
+		memmove(out, in, n);
+		return;
+	}
+
+	/*
+	 * The mapping has only 256 inputs: a table built with the reference
+	 * formula is cheaper per pixel than any per-lane multiply and divide.
+	 */
+	for (uint32_t v = 0; v < 256; v++) {
+		uint8_t px = v;
+
+		fp_dsp_contrast_stretch_ref(&px, &lut[v], 1, lo, hi);
+	}
+
+	for (; i + 4 <= n; i += 4) {
+		uint32_t w = fp_load4(in + i);
+
+		fp_store4(out + i, lut[w & 0xFFU] | (lut[(w >> 8) & 0xFFU] << 8) |
+					   (lut[(w >> 16) & 0xFFU] << 16) |
+					   ((uint32_t)lut[w >> 24] << 24));
+	}
+
+	for (; i < n; i++) {
+		out[i] = lut[in[i]];
+	}
+}
+
+void fp_dsp_filter3x3(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+		      const int8_t kernel[9], uint8_t shift)
+{
+	uint32_t k02[3];
+	uint32_t k1l[3];
+	uint32_t k1h[3];
+
+	if (width < 4 || height < 3) {
+		fp_dsp_filter3x3_ref(in, out, width, height, kernel, shift);
+		return;
+	}
+
+	/* Coefficients as signed halfword pairs matching the pixel lanes */
+	for (int r = 0; r < 3; r++) {
+		k02[r] = (uint16_t)kernel[r * 3] | ((uint32_t)(int32_t)kernel[r * 3 + 2] << 16);
+		k1l[r] = (uint16_t)kernel[r * 3 + 1];
+		k1h[r] = (uint32_t)(int32_t)kernel[r * 3 + 1] << 16;
+	}
+
+	memcpy(out, in, width);
+	memcpy(out + (height - 1U) * width, in + (height - 1U) * width, width);
+
+	for (uint32_t y = 1; y + 1 < height; y++) {
+		const uint8_t *rows[3] = {
+			in + (y - 1) * width,
+			in + y * width,
+			in + (y + 1) * width,
+		};
+		uint8_t *dst = out + y * width;
+		uint32_t x = 1;
+
+		dst[0] = rows[1][0];
+		dst[width - 1] = rows[1][width - 1];
+
+		/*
+		 * A word at x - 1 holds p[x-1..x+2]. Its even bytes (p[x-1], p[x+1])
+		 * and odd bytes (p[x], p[x+2]) give two outputs per row with four
+		 * dual multiply-accumulates.
+		 */
+		for (; x + 2 < width; x += 2) {
+			int32_t acc0 = 0;
+			int32_t acc1 = 0;
+
+			for (int r = 0; r < 3; r++) {
+				uint32_t w = fp_load4(rows[r] + x - 1);
+				uint32_t e = __UXTB16(w);
+				uint32_t o = __UXTB16(__ROR(w, 8));
+
+				acc0 = (int32_t)__SMLAD(e, k02[r], (uint32_t)acc0);
+				acc0 = (int32_t)__SMLAD(o, k1l[r], (uint32_t)acc0);
+				acc1 = (int32_t)__SMLAD(o, k02[r], (uint32_t)acc1);
+				acc1 = (int32_t)__SMLAD(e, k1h[r], (uint32_t)acc1);
+			}
+
+			dst[x] = __USAT(acc0 >> shift, 8);
+			dst[x + 1] = __USAT(acc1 >> shift, 8);
+		}
+
+		/* Odd interior width: the last pixel */
+		if (x + 1 < width) {
+			int32_t acc = 0;
+
+			for (int r = 0; r < 3; r++) {
+				for (int c = 0; c < 3; c++) {
+					acc += kernel[r * 3 + c] * rows[r][x - 1 + c];
+				}
+			}
+			dst[x] = __USAT(acc >> shift, 8);
+		}
+	}
+}
+
+#else /* !__ARM_FEATURE_DSP */
+
+void fp_dsp_bg_subtract(const uint8_t *in, const uint8_t *bg, uint8_t *out, size_t n)
+{
+	fp_dsp_bg_subtract_ref(in, bg, out, n);
+}
+
+void fp_dsp_col_normalize(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+			  const uint8_t *offset, const uint16_t *gain)
+{
+	fp_dsp_col_normalize_ref(in, out, width, height, offset, gain);
+}
+
+void fp_dsp_histogram(const uint8_t *in, size_t n, uint32_t hist[256])
+{
+	fp_dsp_histogram_ref(in, n, hist);
+}
+
+void fp_dsp_contrast_stretch(const uint8_t *in, uint8_t *out, size_t n, uint8_t lo, uint8_t hi)
+{
+	fp_dsp_contrast_stretch_ref(in, out, n, lo, hi);
+}
+
+void fp_dsp_filter3x3(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+		      const int8_t kernel[9], uint8_t shift)
+{
+	fp_dsp_filter3x3_ref(in, out, width, height, kernel, shift);
+}
+
+#endif /* __ARM_FEATURE_DSP */
@@ -0,0 +1,107 @@
+/*
+ * Fingerprint frame DSP kernels, scalar reference versions
+ *
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "../../include/elan/fp_dsp.h"
+
+static inline uint8_t fp_clamp_u8(int32_t v)
+{
+	return v < 0 ? 0 : (v > 255 ? 255 : (uint8_t)v);
+}
+
+void fp_dsp_bg_subtract_ref(const uint8_t *in, const uint8_t *bg, uint8_t *out, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		out[i] = in[i] > bg[i] ? in[i] - bg[i] : 0;
+	}
+}
+
+void fp_dsp_col_normalize_ref(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+			      const uint8_t *offset, const uint16_t *gain)
+{
+	for (uint32_t y = 0; y < height; y++) {
+		const uint8_t *src = in + y * width;
+		uint8_t *dst = out + y * width;
+
+		for (uint32_t x = 0; x < width; x++) {
+			uint32_t v = src[x] > offset[x] ? src[x] - offset[x] : 0;
+
+			dst[x] = fp_clamp_u8((int32_t)((v * gain[x]) >> 8));
+		}
+	}
+}
+
+void fp_dsp_histogram_ref(const uint8_t *in, size_t n, uint32_t hist[256])
+{
+	memset(hist, 0, 256 * sizeof(hist[0]));
+
+	for (size_t i = 0; i < n; i++) {
+		hist[in[i]]++;
+	}
+}
+
+void fp_dsp_stretch_range(const uint32_t hist[256], size_t clip, uint8_t *lo, uint8_t *hi)
+{
+	size_t sum = 0;
+	int v;
+
+	for (v = 0; v < 255; v++) {
+		sum += hist[v];
+		if (sum > clip) {
+			break;
+		}
+	}
+	*lo = v;
+
+	sum = 0;
+	for (v = 255; v > 0; v--) {
+		sum += hist[v];
+		if (sum > clip) {
+			break;
+		}
+	}
+	*hi = v;
+}
+
+void fp_dsp_contrast_stretch_ref(const uint8_t *in, uint8_t *out, size_t n, uint8_t lo,
+				 uint8_t hi)
+{
+	if (hi <= lo) {
+		memmove(out, in, n);
+		return;
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		int32_t v = in[i] - lo;
+
+		out[i] = fp_clamp_u8(v * 255 / (hi - lo));
+	}
+}
+
+void fp_dsp_filter3x3_ref(const uint8_t *in, uint8_t *out, uint16_t width, uint16_t height,
+			  const int8_t kernel[9], uint8_t shift)
+{
+	for (uint32_t y = 0; y < height; y++) {
+		for (uint32_t x = 0; x < width; x++) {
+			int32_t acc = 0;
+
+			if (y == 0 || x == 0 || y == height - 1U || x == width - 1U) {
+				out[y * width + x] = in[y * width + x];
+				continue;
+			}
+
+			for (int dy = -1; dy <= 1; dy++) {
+				for (int dx = -1; dx <= 1; dx++) {
+					acc += kernel[(dy + 1) * 3 + dx + 1] *
+					       in[(y + dy) * width + x + dx];
+				}
+			}
+
+			out[y * width + x] = fp_clamp_u8(acc >> shift);
+		}
+	}
+}
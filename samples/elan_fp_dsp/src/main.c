@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Elan Microelectronics Corp.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Cross-checks the SIMD fingerprint frame kernels against their scalar
+ * references on random frames and prints the cycles each version takes.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/printk.h>
+#include "../../../include/elan/fp_dsp.h"
+
+#define FRAME_W 160
+#define FRAME_H 160
+#define FRAME_N (FRAME_W * FRAME_H)
+#define ROUNDS  8
+
+static uint8_t frame[FRAME_N];
+static uint8_t bg[FRAME_N];
+static uint8_t out_simd[FRAME_N];
+static uint8_t out_ref[FRAME_N];
+static uint8_t offset[FRAME_W];
+static uint16_t gain[FRAME_W];
+static uint32_t hist_simd[256];
+static uint32_t hist_ref[256];
+
+static int failures;
+
+static void check(const char *name, const void *a, const void *b, size_t len,
+		  uint32_t simd_cycles, uint32_t ref_cycles)
+{
+	bool ok = memcmp(a, b, len) == 0;
+
+	printk("%-16s %s  simd %7u cyc  ref %7u cyc\n", name, ok ? "PASS" : "FAIL", simd_cycles,
+	       ref_cycles);
+	if (!ok) {
+		failures++;
+	}
+}
+
+#define TIMED(cycles, call)                                                                        \
+	do {                                                                                       \
+		uint32_t t0 = k_cycle_get_32();                                                    \
+		call;                                                                              \
+		(cycles) = k_cycle_get_32() - t0;                                                  \
+	} while (0)
+
+static void run_round(void)
+{
+	/* A sharpening kernel with negative taps exercises the clamping */
+	static const int8_t sharpen[9] = {0, -1, 0, -1, 5, -1, 0, -1, 0};
+	static const int8_t blur[9] = {1, 2, 1, 2, 4, 2, 1, 2, 1};
+	uint32_t simd;
+	uint32_t ref;
+	uint8_t lo;
+	uint8_t hi;
+
+	sys_rand_get(frame, sizeof(frame));
+	sys_rand_get(bg, sizeof(bg));
+	for (int x = 0; x < FRAME_W; x++) {
+		offset[x] = sys_rand32_get() & 0x3F;
+		gain[x] = 0x100 + (sys_rand32_get() & 0xFF);
+	}
+
+	TIMED(simd, fp_dsp_bg_subtract(frame, bg, out_simd, FRAME_N));
+	TIMED(ref, fp_dsp_bg_subtract_ref(frame, bg, out_ref, FRAME_N));
+	check("bg_subtract", out_simd, out_ref, FRAME_N, simd, ref);
+
+	TIMED(simd, fp_dsp_col_normalize(frame, out_simd, FRAME_W, FRAME_H, offset, gain));
+	TIMED(ref, fp_dsp_col_normalize_ref(frame, out_ref, FRAME_W, FRAME_H, offset, gain));
+	check("col_normalize", out_simd, out_ref, FRAME_N, simd, ref);
+
+	TIMED(simd, fp_dsp_histogram(frame, FRAME_N, hist_simd));
+	TIMED(ref, fp_dsp_histogram_ref(frame, FRAME_N, hist_ref));
+	check("histogram", hist_simd, hist_ref, sizeof(hist_simd), simd, ref);
+
+	fp_dsp_stretch_range(hist_ref, FRAME_N / 100, &lo, &hi);
+	TIMED(simd, fp_dsp_contrast_stretch(frame, out_simd, FRAME_N, lo, hi));
+	TIMED(ref, fp_dsp_contrast_stretch_ref(frame, out_ref, FRAME_N, lo, hi));
+	check("contrast_stretch", out_simd, out_ref, FRAME_N, simd, ref);
+
+	TIMED(simd, fp_dsp_filter3x3(frame, out_simd, FRAME_W, FRAME_H, sharpen, 0));
+	TIMED(ref, fp_dsp_filter3x3_ref(frame, out_ref, FRAME_W, FRAME_H, sharpen, 0));
+	check("filter3x3 sharp", out_simd, out_ref, FRAME_N, simd, ref);
+
+	TIMED(simd, fp_dsp_filter3x3(frame, out_simd, FRAME_W - 1, FRAME_H, blur, 4));
+	TIMED(ref, fp_dsp_filter3x3_ref(frame, out_ref, FRAME_W - 1, FRAME_H, blur, 4));
+	check("filter3x3 blur", out_simd, out_ref, (FRAME_W - 1) * FRAME_H, simd, ref);
+}
+
+int main(void)
+{
+	printk("Fingerprint DSP kernel self-check, %dx%d frames\n", FRAME_W, FRAME_H);
+
+	for (int i = 0; i < ROUNDS; i++) {
+		run_round();
+	}
+
+	printk("%s: %d failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+
+	return 0;
+}
@@ -14,10 +14,9 @@
 #include <zephyr/logging/log.h>
 #include <string.h>
 #include <stdio.h>
+#include "../../../include/zephyr/drivers/crypto/crypto_em32.h"
 
 LOG_MODULE_REGISTER(sha_large_data_test, LOG_LEVEL_INF);
-/* Driver helper to inform total message length for chunked mode */
-extern int crypto_em32_sha_set_total_length(const struct device *dev, size_t total_bytes);
 
 
 /* Test data size: 400KB (multiple of 64 bytes, no padding needed) */